@@ -4,6 +4,7 @@
 #include "../pipeline/00_LeapConnection.hpp"
 #include "../core/DeviceHandAssignedEvent.hpp"
 #include <sstream>
+#include <iomanip>
 #include "../ui/MainAppWindow.h"
 #include <iostream>
 #include <string>
@@ -14,7 +15,7 @@
 #include "../core/DeviceLostEvent.hpp"
 #include "../core/FrameData.hpp"
 #include "../core/ConfigManager.h"
-#include "../utils/SpscQueue.hpp" // Include the queue header
+#include "../core/FrameChannel.hpp" // Recycled frame channel shared with LeapInput
 #include "../ui/UIController.hpp" // For HandAssignmentEvent
 
 #include "../pipeline/01_LeapPoller.hpp"
@@ -25,8 +26,9 @@
 #include "../core/DeviceAliasManager.hpp"
 #include "transport/osc/OscMessage.hpp"
 #include "../core/AppLogger.hpp"
+#include "../utils/ThreadAffinity.h"
 
-// Define queue capacity here or make it configurable
+// Number of preallocated frames cycling between the poll thread and the main loop
 const size_t FRAME_QUEUE_CAPACITY = 256;
 
 // Process queued hand assignments from UIController
@@ -52,22 +54,23 @@ AppCore::AppCore(std::shared_ptr<IConfigStore> configManager,
     : configManager_(std::move(configManager))
     , uiManager_(uiManager)
     , logger_(std::move(logger))
-    // Create the shared queue instance here
-    , frameDataQueue_(std::make_shared<SpscQueue<FrameData>>(FRAME_QUEUE_CAPACITY))
+    // Create the shared frame channel here; the overflow policy is applied in start()
+    , frameChannel_(std::make_shared<FrameChannel>(FRAME_QUEUE_CAPACITY))
+    , frameDrain_(FRAME_QUEUE_CAPACITY)
     // Log queue state immediately after creation
     , connectionManager_() // Connection manager needs to be initialized before LeapInput
     // Initialize LeapSorter here with its lambda
-    , leapSorter_([this](const std::string& serial, const FrameData& frame) {
+    , leapSorter_([this](const std::string& serial, const FrameData& frame, HandMask hands) {
                       // This lambda is called by LeapSorter when it finishes processing
-                      // It routes the frame to the next stage (DataProcessor)
-                      if(dataProcessor_) dataProcessor_->processData(serial, frame);
+                      // It routes the frame and its assigned hands to the next stage (DataProcessor)
+                      if(dataProcessor_) dataProcessor_->processData(serial, frame, hands);
                   })
 { // Constructor Body starts here
-    // Log the state of frameDataQueue_ BEFORE passing it to LeapInput
+    // Log the state of frameChannel_ BEFORE passing it to LeapInput
     if (logger_) {
-        logger_->log(frameDataQueue_ ? "AppCore: frameDataQueue_ created successfully." : "AppCore: frameDataQueue_ is NULL after make_shared!");
+        logger_->log(frameChannel_ ? "AppCore: frameChannel_ created successfully." : "AppCore: frameChannel_ is NULL after make_shared!");
     } else {
-        OutputDebugStringA(frameDataQueue_ ? "AppCore: frameDataQueue_ created successfully (logger null).\n" : "AppCore: frameDataQueue_ is NULL after make_shared! (logger null).\n");
+        OutputDebugStringA(frameChannel_ ? "AppCore: frameChannel_ created successfully (logger null).\n" : "AppCore: frameChannel_ is NULL after make_shared! (logger null).\n");
     }
 
     // Ensure logger is valid before proceeding (already checked below, but good place)
@@ -76,20 +79,23 @@ AppCore::AppCore(std::shared_ptr<IConfigStore> configManager,
         throw std::runtime_error("AppCore logger is null");
     }
     // Ensure queue is valid before creating LeapInput
-    if (!frameDataQueue_) {
-        logger_->log("FATAL ERROR: AppCore frameDataQueue_ is null before LeapInput creation!");
-        throw std::runtime_error("AppCore frameDataQueue_ is null before LeapInput creation");
+    if (!frameChannel_) {
+        logger_->log("FATAL ERROR: AppCore frameChannel_ is null before LeapInput creation!");
+        throw std::runtime_error("AppCore frameChannel_ is null before LeapInput creation");
     }
 
     // Initialize LeapInput here in the constructor body instead of initializer list
-    // to ensure frameDataQueue_ is definitely initialized and logged first.
+    // to ensure frameChannel_ is definitely initialized and logged first.
     try {
-        leapInput_ = std::make_unique<LeapInput>(connectionManager_.getConnection(), frameDataQueue_);
+        leapInput_ = std::make_unique<LeapInput>(connectionManager_.getConnection(), frameChannel_);
     } catch (const std::exception& e) {
         logger_->log("FATAL ERROR: Failed to construct LeapInput: " + std::string(e.what()));
         throw; // Re-throw exception
     }
 
+    // Sorter resolves hand assignments by the device slots the channel stamps on frames
+    leapSorter_.setDeviceSlots(&frameChannel_->deviceSlots());
+
     // Assign frameSource_ to point to leapInput_ as IFrameSource
     frameSource_ = static_cast<IFrameSource*>(static_cast<LeapInput*>(leapInput_.get()));
     if (!logger_) {
@@ -108,22 +114,23 @@ AppCore::AppCore(std::shared_ptr<IConfigStore> configManager,
         dataProcessor_ = std::make_unique<DataProcessor>(
             configManager_->getDeviceAliasManager(),
             [this](const OscMessage& message) {
-                if(logger_) {
-                    logger_->log("[DP-CALLBACK] Addr: " + message.address + " #Vals: " + std::to_string(message.values.size()));
-                } else {
-                    std::cout << "[DP-CALLBACK] Addr: " << message.address << " #Vals: " << message.values.size() << std::endl;
-                }
-                
-                if(logger_) logger_->log("AppCore: Routing OSC message via ITransportSink.");
+                // Per-message path: no logging here, it would allocate on every send.
                 if (oscSender_) {
                     oscSender_->sendOscMessage(message);
                 }
             },
-            [this](const FrameData& frame) { 
-                uiManager_.handleTrackingData(frame); 
+            [this](const FrameData& frame, HandMask hands) {
+                uiManager_.handleTrackingData(frame, hands);
             },
             logger_
         );
+        dataProcessor_->setOscBundleCallback([this](const OscBundle& bundle) {
+            if (oscSender_) oscSender_->sendOscBundle(bundle);
+        });
+        // Gesture events: sent as soon as they fire, ahead of the hand's values
+        dataProcessor_->setOscEventCallback([this](const OscMessage& message) {
+            if (oscSender_) oscSender_->sendOscMessage(message);
+        });
          logger_->log("DataProcessor initialized successfully.");
     } catch (const std::exception& e) {
          logger_->log("FATAL ERROR: Failed to initialize DataProcessor: " + std::string(e.what()));
@@ -182,13 +189,13 @@ AppCore::AppCore(std::shared_ptr<IConfigStore> configManager,
         logger_->log("UIController hand assignment callback set.");
 
         uiController_->setConfigUpdateCallback(
-            [this](bool p, bool w, bool t, bool i, bool m, bool r, bool pi, 
-                   bool po, bool pv, bool pn, bool vt, bool fie,
-                   bool pinch, bool grab)
+            [this](OscFieldMask fields)
             {
                 logger_->log("AppCore: Received filter update from UIController.");
                 if (dataProcessor_) {
-                    dataProcessor_->setFilterSettings(p, w, t, i, m, r, pi, po, pv, pn, vt, fie, pinch, grab);
+                    dataProcessor_->setFieldMask(fields);
+                    if (frameWorkers_) frameWorkers_->setFieldMask(fields);
+                    if (fusedProcessor_) fusedProcessor_->setFieldMask(fields);
                     logger_->log("AppCore: Updated DataProcessor filter settings.");
                 } else {
                      logger_->log("ERROR: AppCore: Cannot update filters, DataProcessor is null!");
@@ -209,7 +216,22 @@ AppCore::AppCore(std::shared_ptr<IConfigStore> configManager,
             }
         );
         logger_->log("UIController OSC Settings update callback set.");
+
+        uiController_->setPoseLibraryUpdateCallback(
+            [this](const std::vector<PoseTemplate>& poses) {
+                const PoseMatchConfig match = configManager_->getPoseMatch();
+                poseLibrary_ = std::make_shared<const PoseLibrary>(poses);
+                if (dataProcessor_) dataProcessor_->setPoses(poseLibrary_, match);
+                if (frameWorkers_) frameWorkers_->forEachProcessor([&](DataProcessor& processor) { processor.setPoses(poseLibrary_, match); });
+                if (fusedProcessor_) fusedProcessor_->setPoses(poseLibrary_, match);
+                logger_->log("AppCore: Pose library updated (" + std::to_string(poses.size()) + " poses).");
+            }
+        );
         
+        uiController_->setCalibrationCallback(
+            [this](UIController::CalibrationCommand command) { handleCalibrationCommand(command); }
+        );
+
         uiController_->initializeOscSettings(configManager_->getOscIp(), configManager_->getOscPort());
         logger_->log("UIController OSC state initialized.");
         uiController_->initializeAllFilters();
@@ -249,6 +271,63 @@ void AppCore::start() {
         return;
     }
     logger_->log("AppCore starting LeapInput...");
+    auto* leapInput = static_cast<LeapInput*>(leapInput_.get());
+    leapInput->setThreadPlacement(configManager_->getThreadPlacement(ThreadNames::LeapPoll));
+    calibrator_.setThreadPlacement(configManager_->getThreadPlacement(ThreadNames::Calibration));
+    const InputConfig input = configManager_->getInput();
+    leapInput->setInputConfig(input);
+    if (input.mode == InputMode::Interpolated) {
+        logger_->log("Leap input: interpolated at " + std::to_string(input.rateHz) + " Hz, " +
+                     std::to_string(input.delayMs) + " ms behind now");
+    } else {
+        logger_->log("Leap input: tracking events");
+    }
+    frameChannel_->setOverflowPolicy(configManager_->getFrameQueueOverflowPolicy());
+    frameDrain_.setThreshold(static_cast<size_t>(configManager_->getCatchUpThreshold()));
+    logger_->log("Frame queue: capacity " + std::to_string(frameChannel_->capacity()) +
+                 ", overflow policy " + frameOverflowPolicyToString(frameChannel_->getOverflowPolicy()) +
+                 ", catch-up threshold " + std::to_string(frameDrain_.getThreshold()));
+    applyProcessingSettings(*dataProcessor_);
+    logger_->log("Hand loss hold: " + std::to_string(configManager_->getHandLossHoldFrames()) + " frames / " +
+                 std::to_string(configManager_->getHandLossHoldMs()) + " ms");
+    const int processingWorkers = configManager_->getProcessingWorkers();
+    if (processingWorkers > 0) {
+        std::vector<ThreadPlacement> workerPlacements;
+        for (int i = 0; i < processingWorkers; ++i) {
+            workerPlacements.push_back(configManager_->getThreadPlacement(ThreadNames::frameWorker(static_cast<size_t>(i))));
+        }
+        frameWorkers_ = std::make_unique<FrameWorkerPool>(
+            static_cast<size_t>(processingWorkers), leapSorter_, configManager_->getDeviceAliasManager(),
+            [this](const FrameData& frame, HandMask hands) {
+                uiManager_.handleTrackingData(frame, hands); // Locks internally; called from the workers
+            },
+            logger_, workerPlacements);
+        frameWorkers_->setFieldMask(dataProcessor_->getFieldMask());
+        frameWorkers_->forEachProcessor([this](DataProcessor& processor) { applyProcessingSettings(processor); });
+        logger_->log("Frame processing: " + std::to_string(processingWorkers) + " worker threads, sharded by device");
+    } else {
+        logger_->log("Frame processing: on the main loop");
+    }
+    const FusionConfig fusion = configManager_->getFusion();
+    if (fusion.enabled) {
+        handFusion_.setConfig(fusion);
+        fusedFrame_.hands.reserve(MAX_HANDS_PER_FRAME);
+        fusedProcessor_ = std::make_unique<DataProcessor>(
+            configManager_->getDeviceAliasManager(),
+            [this](const OscMessage& message) { if (oscSender_) oscSender_->sendOscMessage(message); },
+            nullptr, // The UI shows the devices themselves
+            logger_);
+        fusedProcessor_->setOscBundleCallback([this](const OscBundle& bundle) {
+            if (oscSender_) oscSender_->sendOscBundle(bundle);
+        });
+        fusedProcessor_->setOscEventCallback([this](const OscMessage& message) {
+            if (oscSender_) oscSender_->sendOscMessage(message);
+        });
+        fusedProcessor_->setFieldMask(dataProcessor_->getFieldMask());
+        applyProcessingSettings(*fusedProcessor_);
+        logger_->log("Fusion: enabled, association radius " + std::to_string(fusion.associationRadiusMm) + " mm, max age " +
+                     std::to_string(fusion.maxAgeMs) + " ms, " + std::to_string(fusion.extrinsics.size()) + " device extrinsics");
+    }
     try {
         leapInput_->start();
     // frameSource_ is ready for getNextFrame
@@ -258,6 +337,16 @@ void AppCore::start() {
         isRunning_ = false;
         throw;
     }
+
+    // Startup report of what thread placement was actually applied.
+    // start() runs on the main/UI loop thread, so that is the thread placed as "ui".
+    logger_->log("Thread placement (" + std::to_string(ThreadAffinity::getProcessorCount()) + " cores):");
+    logger_->log("  " + leapInput->getThreadPlacementReport());
+    logger_->log("  " + ThreadAffinity::applyPlacementToCurrentThread(ThreadNames::Ui, configManager_->getThreadPlacement(ThreadNames::Ui)));
+    if (frameWorkers_) {
+        for (const std::string& report : frameWorkers_->getThreadPlacementReports()) logger_->log("  " + report);
+    }
+    logger_->log("  " + std::string(ThreadNames::Calibration) + ": only exists while a calibration solves; placed and logged then");
 }
 
 void AppCore::stop() {
@@ -271,6 +360,8 @@ void AppCore::stop() {
     logger_->log("Requesting LeapInput stop..."); // Log 2
     leapInput_->stop();
     logger_->log("LeapInput stop completed."); // Log 3
+    frameWorkers_.reset(); // Joins the worker threads
+    fusedProcessor_.reset();
 
     // frameSource_ no longer valid after stop
     logger_->log("LeapInput thread joined."); // Log 4 (Renamed for clarity)
@@ -310,6 +401,34 @@ void AppCore::handleDeviceLost(const std::string& serialNumber) {
     if (!logger_) return;
     logger_->log("AppCore: Device lost: " + serialNumber);
     uiManager_.handleDeviceLost({serialNumber});
+
+    // Runs on the poll thread. The main loop zeroes the device's hands after
+    // draining the frames it sent before it was lost.
+    const uint8_t slot = frameChannel_->deviceSlots().find(serialNumber);
+    if (slot != INVALID_DEVICE_SLOT) {
+        lostDeviceSlots_[slot].store(true, std::memory_order_release);
+    }
+}
+
+void AppCore::emitDeviceLoss(uint32_t slots) {
+    const DeviceSlotTable& table = frameChannel_->deviceSlots();
+    for (size_t slot = 0; slot < MAX_TRACKED_DEVICES; ++slot) {
+        if (!(slots & (1u << slot))) continue;
+        lostMarker_.deviceId = table.idAt(slot);
+        lostMarker_.deviceSlot = static_cast<uint8_t>(slot);
+        lostMarker_.hands.clear();
+        lostMarker_.deviceLost = true;
+        if (fusedProcessor_) handFusion_.update(lostMarker_);
+        if (calibrator_.isCollecting()) calibrator_.addFrame(lostMarker_);
+        if (frameWorkers_) {
+            if (!frameWorkers_->submit(lostMarker_)) {
+                flushFrameWorkers();
+                frameWorkers_->submit(lostMarker_);
+            }
+        } else {
+            leapSorter_.processFrame(lostMarker_.deviceId, lostMarker_);
+        }
+    }
 }
 
 void AppCore::emitTestFrame(const std::string& deviceId, const FrameData& frame) {
@@ -319,19 +438,36 @@ void AppCore::emitTestFrame(const std::string& deviceId, const FrameData& frame)
 }
 
 int AppCore::processPendingFrames() {
-    if (!isRunning_ || !frameDataQueue_) return 0; // Safety checks, return 0 if not running or queue null
+    if (!isRunning_ || !frameChannel_) return 0; // Safety checks, return 0 if not running or channel null
 
-    std::optional<FrameData> frameOpt;
-    // Drain the queue (process up to N frames per tick? or all?)
-    // Let's process all available for now.
-    int processedCount = 0;
-    while ((frameOpt = frameDataQueue_->try_pop())) {
-         FrameData& frame = *frameOpt; // Get the frame data
+    // Take loss reports before draining: everything a device sent before its
+    // loss was reported is then part of this drain, so the reset comes last.
+    uint32_t lostSlots = 0;
+    for (size_t slot = 0; slot < MAX_TRACKED_DEVICES; ++slot) {
+        if (lostDeviceSlots_[slot].exchange(false, std::memory_order_acquire)) lostSlots |= 1u << slot;
+    }
 
+    // Drain the frame channel. Past the catch-up threshold only each device's
+    // newest frame (plus hand-loss/return transitions) goes through the pipeline.
+    const int processedCount = frameDrain_.drain(*frameChannel_, [this](const FrameData& frame) {
+        if (fusedProcessor_) handFusion_.update(frame);
+        if (calibrator_.isCollecting()) calibrator_.addFrame(frame);
+        if (frameWorkers_) {
+            // A worker that already holds a full ring of this tick's frames is waited for
+            if (!frameWorkers_->submit(frame)) {
+                flushFrameWorkers();
+                frameWorkers_->submit(frame);
+            }
+            return;
+        }
          // Feed the frame into the pipeline (LeapSorter is a direct member, guaranteed to exist)
-         leapSorter_.processFrame(frame.deviceId, frame); // Pass to sorter
-         processedCount++;
-    }
+         leapSorter_.processFrame(frame.deviceId, frame);
+    });
+    if (lostSlots) emitDeviceLoss(lostSlots);
+    if (frameWorkers_) flushFrameWorkers();
+    if (fusedProcessor_ && (processedCount > 0 || lostSlots)) processFusedFrame();
+    if (calibrator_.isCollecting() || calibrator_.isSolving()) updateCalibration();
+    publishQueueStats();
     // Optional: Log if many frames were processed (might indicate main thread lag)
     // if (processedCount > 10 && logger_) {
     //     logger_->log("Processed " + std::to_string(processedCount) + " frames in one tick.");
@@ -340,6 +476,123 @@ int AppCore::processPendingFrames() {
     return processedCount;
 }
 
+void AppCore::applyProcessingSettings(DataProcessor& processor) {
+    processor.setHandLossHold(static_cast<uint32_t>(configManager_->getHandLossHoldFrames()),
+                              static_cast<uint32_t>(configManager_->getHandLossHoldMs()));
+    processor.setZeroBundleRepeats(static_cast<uint32_t>(configManager_->getZeroBundleRepeats()));
+    processor.setSmoothing(configManager_->getSmoothing());
+    processor.setPrediction(configManager_->getPrediction());
+    // Frame timestamps are on the LeapC clock, so frame age is measured against it
+    processor.setClock([]() { return static_cast<uint64_t>(LeapGetNow()); });
+    processor.setGainCurve(configManager_->getGainCurve());
+    processor.setPositionOutput(configManager_->getPositionOutput());
+    processor.setInteractionBoxes(configManager_->getInteractionBoxes(), configManager_->getLearnInteractionBoxes());
+    processor.setSkeletonQuantized(configManager_->getSkeletonQuantized());
+    processor.setGestures(configManager_->getGestures());
+    if (!poseLibrary_) poseLibrary_ = std::make_shared<const PoseLibrary>(configManager_->getPoses());
+    processor.setPoses(poseLibrary_, configManager_->getPoseMatch());
+}
+
+void AppCore::processFusedFrame() {
+    // After the devices' own output, once per tick: the fused hands at the newest frame time
+    handFusion_.fuse(fusedFrame_);
+    fusedProcessor_->processData(fusedFrame_.deviceId, fusedFrame_);
+}
+
+void AppCore::handleCalibrationCommand(UIController::CalibrationCommand command) {
+    using State = UIController::CalibrationState;
+    switch (command) {
+        case UIController::CalibrationCommand::Start:
+            calibrator_.start();
+            logger_->log("AppCore: Calibration started.");
+            uiController_->setCalibrationState(State::Collecting, "Show one hand to two or more devices and move it around.");
+            break;
+        case UIController::CalibrationCommand::Solve:
+            if (calibrator_.solve()) {
+                logger_->log("AppCore: Calibration solving against " + calibrator_.referenceSerial() + "...");
+                uiController_->setCalibrationState(State::Solving, "Solving against " + calibrator_.referenceSerial() + "...");
+            } else {
+                uiController_->setCalibrationState(State::Collecting, "No simultaneous samples yet.");
+            }
+            break;
+        case UIController::CalibrationCommand::Cancel:
+            calibrator_.cancel();
+            logger_->log("AppCore: Calibration cancelled.");
+            uiController_->setCalibrationState(State::Idle, "");
+            break;
+    }
+}
+
+void AppCore::updateCalibration() {
+    using State = UIController::CalibrationState;
+    if (calibrator_.isCollecting()) {
+        std::string status = calibrator_.referenceSerial().empty()
+            ? "Waiting for a hand..."
+            : "Reference " + calibrator_.referenceSerial() + ".";
+        for (const auto& [serial, samples] : calibrator_.sampleCounts()) {
+            status += " " + serial + ": " + std::to_string(samples) + " samples.";
+        }
+        uiController_->setCalibrationState(State::Collecting, status);
+        return;
+    }
+    if (!calibrator_.takeResults(calibrationResults_)) return;
+    logger_->log("Thread placement: " + calibrator_.getThreadPlacementReport());
+
+    // The results map onto the reference device; chain them with its own extrinsic
+    const FusionConfig fusion = configManager_->getFusion();
+    const auto reference = fusion.extrinsics.find(calibrator_.referenceSerial());
+    const RigidTransform referenceToRoom = reference != fusion.extrinsics.end() ? reference->second : RigidTransform();
+    std::ostringstream status;
+    status << std::fixed << std::setprecision(1);
+    for (const CalibrationResult& result : calibrationResults_) {
+        if (!result.solved) {
+            status << result.serial << ": not enough distinct samples. ";
+            continue;
+        }
+        configManager_->setDeviceExtrinsic(result.serial, compose(referenceToRoom, result.transform));
+        status << result.serial << ": " << result.rmsErrorMm << " mm RMS (" << result.inliers << " of "
+               << result.pairs << " points). ";
+    }
+    configManager_->saveConfig();
+    handFusion_.setConfig(configManager_->getFusion());
+    logger_->log("AppCore: Calibration against " + calibrator_.referenceSerial() + ": " + status.str());
+    uiController_->setCalibrationState(State::Idle, status.str());
+}
+
+void AppCore::flushFrameWorkers() {
+    // Merges the per-worker rings into the one sender; each device's output stays in order
+    frameWorkers_->flush(*oscSender_);
+}
+
+void AppCore::publishQueueStats() {
+    const int intervalMs = configManager_->getQueueStatsIntervalMs();
+    const auto now = std::chrono::steady_clock::now();
+    // The UI still gets refreshed once a second when the OSC stats are disabled
+    const auto interval = std::chrono::milliseconds(intervalMs > 0 ? intervalMs : 1000);
+    if (now - lastQueueStatsTime_ < interval) return;
+    lastQueueStatsTime_ = now;
+
+    auto& aliasManager = configManager_->getDeviceAliasManager();
+    const DeviceSlotTable& slots = frameChannel_->deviceSlots();
+    for (size_t slot = 0; slot < slots.size(); ++slot) {
+        const std::string serial = slots.idAt(slot);
+        const FrameChannel::DeviceStats stats = frameChannel_->getDeviceStats(slot);
+        uiManager_.handleQueueStats(serial, stats.dropped, stats.highWater);
+
+        if (intervalMs > 0 && oscSender_) {
+            const std::string prefix = "/leap/stats/" + aliasManager.getOrAssignAlias(serial) + "/";
+            oscSender_->sendOscMessage({prefix + "dropped", {static_cast<float>(stats.dropped)}});
+            oscSender_->sendOscMessage({prefix + "queue_high_water", {static_cast<float>(stats.highWater)}});
+        }
+    }
+    if (intervalMs > 0 && oscSender_) {
+        oscSender_->sendOscMessage({"/leap/stats/dropped", {static_cast<float>(frameChannel_->getTotalDropped())}});
+        oscSender_->sendOscMessage({"/leap/stats/queue_high_water", {static_cast<float>(frameChannel_->getHighWater())}});
+        oscSender_->sendOscMessage({"/leap/stats/queue_capacity", {static_cast<float>(frameChannel_->capacity())}});
+        oscSender_->sendOscMessage({"/leap/stats/catch_up_skipped", {static_cast<float>(frameDrain_.getSkippedCount())}});
+    }
+}
+
 OscController* AppCore::getOscController() {
     // Assuming the member is named oscController_ and is a std::unique_ptr
     // Adjust if the member name or type is different (e.g., if it holds OscSenderStage directly)
@@ -8,6 +8,7 @@
 #include <memory>
 #include "../pipeline/02_LeapSorter.hpp"
 #include "../pipeline/03_DataProcessor.hpp"
+#include "../pipeline/03_FrameWorkerPool.hpp"
 #include "../pipeline/04_OscSender.hpp"
 #include "../core/interfaces/ITransportSink.hpp" // Correct path for interface
 #include "../ui/UIController.hpp"
@@ -15,8 +16,12 @@
 
 // Forward declare dependencies passed by reference
 #include "../core/interfaces/IConfigStore.hpp"
-#include "core/FrameData.hpp" // Include FrameData for queue
-#include "utils/SpscQueue.hpp" // Include SpscQueue
+#include "core/FrameData.hpp" // Include FrameData for the frame channel
+#include "core/FrameChannel.hpp" // Include FrameChannel
+#include "core/CatchUpDrain.hpp"
+#include "core/HandFusion.hpp"
+#include "core/ExtrinsicCalibration.hpp"
+#include <chrono>
 #include <memory> // Ensure shared_ptr is available
 class MainAppWindow;
 struct FrameData; // Can likely remain forward-declared
@@ -27,6 +32,7 @@ class AppLogger; // Add forward declaration for AppLogger
 #include <string>
 #include <iostream> // For default logger lambda
 #include <atomic>
+#include <array>
 #include "transport/osc/OscController.h" // Make sure this is included
 
 class AppCore {
@@ -58,6 +64,19 @@ private:
     // Event Handlers (implement in .cpp)
     void handleDeviceConnected(const LeapPoller::DeviceInfo& info); // Uses definition from 01_LeapPoller.hpp
     void handleDeviceLost(const std::string& serialNumber);
+    // Sends a deviceLost marker frame through the pipeline for each slot in `slots` (bit per slot)
+    void emitDeviceLoss(uint32_t slots);
+    // Pushes frame queue drop/high-water counters to the UI and, as /leap/stats/*, over OSC
+    void publishQueueStats();
+    // Sends the frame workers' output for every frame submitted so far
+    void flushFrameWorkers();
+    // Applies the config.json processing settings to one DataProcessor (the inline one or a worker's)
+    void applyProcessingSettings(DataProcessor& processor);
+    // Sends the fused hands of every device frame taken so far as /leap/fused/...
+    void processFusedFrame();
+    // UI calibration commands, and per tick: progress, then the solved extrinsics once ready
+    void handleCalibrationCommand(UIController::CalibrationCommand command);
+    void updateCalibration();
 
     // Core Components (Initialize in constructor)
     LeapConnection connectionManager_;
@@ -67,10 +86,27 @@ private:
     LeapSorter leapSorter_;
     // DataProcessor is now a unique_ptr
     std::unique_ptr<DataProcessor> dataProcessor_;
+    // Set while running with processing_workers > 0; replaces the leapSorter_ -> dataProcessor_ path
+    std::unique_ptr<FrameWorkerPool> frameWorkers_;
     std::unique_ptr<ITransportSink> oscSender_; // Use interface for transport sink
+    // Set while running with fusion enabled: every device frame also feeds
+    // handFusion_, whose merged hands go through their own DataProcessor
+    HandFusion handFusion_;
+    std::unique_ptr<DataProcessor> fusedProcessor_;
+    FrameData fusedFrame_; // Reused for every fused frame
+    // Built once per pose library change and shared by every processor
+    std::shared_ptr<const PoseLibrary> poseLibrary_;
+    // Collects device pairs on the main loop while calibrating; solves on its own thread
+    ExtrinsicCalibrator calibrator_;
+    std::vector<CalibrationResult> calibrationResults_;
 
-    // Queue for decoupling polling thread from main thread (SHARED OWNERSHIP)
-    std::shared_ptr<SpscQueue<FrameData>> frameDataQueue_;
+    // Recycled frames decoupling polling thread from main thread (SHARED OWNERSHIP)
+    std::shared_ptr<FrameChannel> frameChannel_;
+    CatchUpDrain frameDrain_; // Consumer side of frameChannel_; skips stale frames after a stall
+    // Set by handleDeviceLost() on the poll thread, taken by processPendingFrames()
+    std::array<std::atomic<bool>, MAX_TRACKED_DEVICES> lostDeviceSlots_{};
+    FrameData lostMarker_; // Reused for the marker frames emitDeviceLoss() sends
+    std::chrono::steady_clock::time_point lastQueueStatsTime_{};
 
     // References to external/UI/Config components (passed in constructor)
     std::shared_ptr<IConfigStore> configManager_; // Use config interface
@@ -0,0 +1,13 @@
+#include "CatchUpDrain.hpp"
+
+CatchUpDrain::CatchUpDrain(size_t maxBatch) {
+    batch_.reserve(maxBatch);
+}
+
+uint8_t CatchUpDrain::handPresenceMask(const FrameData& frame) {
+    uint8_t mask = 0;
+    for (const HandData& hand : frame.hands) {
+        mask |= handPresenceBit(hand.handType);
+    }
+    return mask;
+}
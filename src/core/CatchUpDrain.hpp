@@ -0,0 +1,100 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "FrameData.hpp"
+#include "FrameChannel.hpp"
+
+// Consumer-side drain for a FrameChannel.
+//
+// Normally every waiting frame is handed on in order. When more than
+// `threshold` frames are waiting (the main loop stalled), the backlog is
+// taken in one batch and only these frames of each device are kept:
+//   - the newest one, and
+//   - every frame whose set of visible hands differs from the frame before
+//     it, so hand loss / hand return still reach the DataProcessor and its
+//     zeroing logic fires exactly as it would have.
+// Everything else is stale and is released unprocessed.
+class CatchUpDrain {
+public:
+    // maxBatch bounds how many frames one catch-up pass takes; use the channel capacity.
+    explicit CatchUpDrain(size_t maxBatch);
+
+    // 0 disables catch-up: every frame is processed.
+    void setThreshold(size_t frames) { threshold_ = frames; }
+    size_t getThreshold() const { return threshold_; }
+
+    // Drains what is currently waiting in channel, calling process(const FrameData&)
+    // for each kept frame in arrival order. Returns the number of frames processed.
+    template<typename Process>
+    int drain(FrameChannel& channel, Process&& process);
+
+    // Frames released without processing since startup (any thread).
+    uint64_t getSkippedCount() const { return skipped_.load(std::memory_order_relaxed); }
+
+    // Bit 0 = a left hand is present, bit 1 = a right hand is present.
+    static uint8_t handPresenceMask(const FrameData& frame);
+
+private:
+    template<typename Process>
+    int drainBacklog(FrameChannel& channel, Process& process);
+
+    size_t threshold_ = 0;
+    std::vector<FrameData*> batch_;                             // Reserved once, reused every pass
+    std::array<uint8_t, MAX_TRACKED_DEVICES> lastMask_{};       // Presence mask of each device's previous frame
+    std::array<size_t, MAX_TRACKED_DEVICES> newestIndex_{};     // Scratch for drainBacklog()
+    std::atomic<uint64_t> skipped_{0};
+};
+
+template<typename Process>
+int CatchUpDrain::drain(FrameChannel& channel, Process&& process) {
+    if (threshold_ > 0 && channel.getPending() > threshold_) {
+        return drainBacklog(channel, process);
+    }
+    int processed = 0;
+    while (FrameData* frame = channel.receive()) {
+        if (frame->deviceSlot != INVALID_DEVICE_SLOT) {
+            lastMask_[frame->deviceSlot] = handPresenceMask(*frame);
+        }
+        process(*frame);
+        channel.release(frame);
+        ++processed;
+    }
+    return processed;
+}
+
+template<typename Process>
+int CatchUpDrain::drainBacklog(FrameChannel& channel, Process& process) {
+    batch_.clear();
+    while (batch_.size() < batch_.capacity()) {
+        FrameData* frame = channel.receive();
+        if (!frame) break;
+        batch_.push_back(frame);
+    }
+
+    for (size_t i = 0; i < batch_.size(); ++i) {
+        const uint8_t slot = batch_[i]->deviceSlot;
+        if (slot != INVALID_DEVICE_SLOT) newestIndex_[slot] = i;
+    }
+
+    int processed = 0;
+    for (size_t i = 0; i < batch_.size(); ++i) {
+        FrameData* frame = batch_[i];
+        const uint8_t slot = frame->deviceSlot;
+        bool keep = true;
+        if (slot != INVALID_DEVICE_SLOT) {
+            const uint8_t mask = handPresenceMask(*frame);
+            keep = i == newestIndex_[slot] || mask != lastMask_[slot];
+            lastMask_[slot] = mask;
+        }
+        if (keep) {
+            process(*frame);
+            ++processed;
+        } else {
+            skipped_.fetch_add(1, std::memory_order_relaxed);
+        }
+        channel.release(frame);
+    }
+    return processed;
+}
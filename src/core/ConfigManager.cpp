@@ -1,12 +1,14 @@
 #include "ConfigManager.h"
 #include "json.hpp" // Use nlohmann::json
 #include "Log.hpp"
+#include "FrameData.hpp" // MAX_TRACKED_DEVICES
 #include <fstream>
 #include <filesystem> // For path manipulation
 #include <shlobj.h>   // For SHGetFolderPath
 #include <windows.h>  // For PWSTR
 #include <KnownFolders.h> // For FOLDERID_LocalAppData
 #include <iomanip> // For std::setw
+#include <algorithm>
 
 using json = nlohmann::json;
 
@@ -33,7 +35,6 @@ std::string getLocalAppDataPath() {
 
 // Constructor - Initialize members with defaults
 ConfigManager::ConfigManager()
-    : baseGain_(1.0f), midGain_(1.0f), maxGain_(1.0f), lowSpeedThreshold_(0.0f), midSpeedThreshold_(0.0f)
 {
     // Constructor body if needed
 }
@@ -94,23 +95,173 @@ bool ConfigManager::loadConfig(const std::string& filename) {
             deviceAliasManager.loadFromJson(j["device_aliases"]);
         }
 
-        // Load Filter Settings using specific members
+        // Load Thread Placement
+        if (j.contains("thread_placement") && j["thread_placement"].is_object()) {
+            threadPlacements_.clear();
+            for (const auto& [threadName, entry] : j["thread_placement"].items()) {
+                if (!entry.is_object()) continue;
+                ThreadPlacement placement;
+                placement.coreIndex = entry.value("core", -1);
+                placement.policy = threadSchedPolicyFromString(entry.value("policy", std::string("default")));
+                placement.priority = entry.value("priority", 0);
+                threadPlacements_[threadName] = placement;
+            }
+        }
+
+        // Load Frame Queue settings
+        this->frameQueueOverflowPolicy_ = frameOverflowPolicyFromString(
+            j.value("frame_queue_overflow_policy", std::string(frameOverflowPolicyToString(this->frameQueueOverflowPolicy_))));
+        this->queueStatsIntervalMs_ = (std::max)(0, j.value("queue_stats_interval_ms", this->queueStatsIntervalMs_));
+        this->catchUpThreshold_ = (std::max)(0, j.value("catch_up_threshold", this->catchUpThreshold_));
+        setProcessingWorkers(j.value("processing_workers", this->processingWorkers_));
+        this->handLossHoldFrames_ = (std::max)(0, j.value("hand_loss_hold_frames", this->handLossHoldFrames_));
+        this->handLossHoldMs_ = (std::max)(0, j.value("hand_loss_hold_ms", this->handLossHoldMs_));
+        setZeroBundleRepeats(j.value("zero_bundle_repeats", this->zeroBundleRepeats_));
+
+        // Load Smoothing, one object per point group
+        if (j.contains("smoothing") && j["smoothing"].is_object()) {
+            SmoothingConfig smoothing = this->smoothing_;
+            for (size_t g = 0; g < SMOOTHING_GROUP_COUNT; ++g) {
+                const SmoothingGroup group = static_cast<SmoothingGroup>(g);
+                const auto entry = j["smoothing"].find(smoothingGroupKey(group));
+                if (entry == j["smoothing"].end() || !entry->is_object()) continue;
+                OneEuroParams& params = smoothing[group];
+                params.enabled = entry->value("enabled", params.enabled);
+                params.minCutoff = entry->value("min_cutoff", params.minCutoff);
+                params.beta = entry->value("beta", params.beta);
+                params.dCutoff = entry->value("d_cutoff", params.dCutoff);
+            }
+            setSmoothing(smoothing);
+        }
+
+        // Load Prediction
+        if (j.contains("prediction") && j["prediction"].is_object()) {
+            const auto& entry = j["prediction"];
+            PredictionConfig prediction = getPrediction();
+            prediction.mode = predictionModeFromString(
+                entry.value("mode", std::string(predictionModeToString(prediction.mode))));
+            prediction.toSendTime = entry.value("to_send_time", prediction.toSendTime);
+            prediction.lookaheadMs = entry.value("lookahead_ms", prediction.lookaheadMs);
+            prediction.maxExtrapolationMs = entry.value("max_extrapolation_ms", prediction.maxExtrapolationMs);
+            prediction.accelerationNoise = entry.value("acceleration_noise", prediction.accelerationNoise);
+            prediction.measurementNoise = entry.value("measurement_noise", prediction.measurementNoise);
+            setPrediction(prediction);
+        }
+
+        // Load Leap input mode
+        if (j.contains("input") && j["input"].is_object()) {
+            const auto& entry = j["input"];
+            InputConfig input = getInput();
+            input.mode = inputModeFromString(entry.value("mode", std::string(inputModeToString(input.mode))));
+            input.rateHz = entry.value("rate_hz", input.rateHz);
+            input.delayMs = entry.value("delay_ms", input.delayMs);
+            setInput(input);
+        }
+
+        // Load Gain Curve
+        if (j.contains("gain_curve") && j["gain_curve"].is_object()) {
+            const auto& entry = j["gain_curve"];
+            GainCurve curve = getGainCurve();
+            curve.baseGain = entry.value("base_gain", curve.baseGain);
+            curve.midGain = entry.value("mid_gain", curve.midGain);
+            curve.maxGain = entry.value("max_gain", curve.maxGain);
+            curve.lowSpeed = entry.value("low_speed_threshold", curve.lowSpeed);
+            curve.midSpeed = entry.value("mid_speed_threshold", curve.midSpeed);
+            curve.velocitySource = gainVelocitySourceFromString(
+                entry.value("velocity_source", std::string(gainVelocitySourceToString(curve.velocitySource))));
+            setGainCurve(curve);
+        }
+
+        // Load Normalized Output settings
+        this->positionOutput_ = positionOutputFromString(
+            j.value("position_output", std::string(positionOutputToString(this->positionOutput_))));
+        this->learnInteractionBoxes_ = j.value("interaction_box_learn", this->learnInteractionBoxes_);
+        if (j.contains("interaction_boxes") && j["interaction_boxes"].is_object()) {
+            this->interactionBoxes_.clear();
+            for (const auto& [serial, entry] : j["interaction_boxes"].items()) {
+                if (!entry.is_object()) continue;
+                const auto min = entry.value("min", std::vector<float>());
+                const auto max = entry.value("max", std::vector<float>());
+                if (min.size() != 3 || max.size() != 3) continue;
+                setInteractionBox(serial, InteractionBox{ {min[0], min[1], min[2]}, {max[0], max[1], max[2]} });
+            }
+        }
+
+        this->skeletonQuantized_ = j.value("skeleton_quantized", this->skeletonQuantized_);
+
+        // Load Gesture thresholds
+        if (j.contains("gestures") && j["gestures"].is_object()) {
+            const auto& entry = j["gestures"];
+            GestureConfig gestures = getGestures();
+            gestures.pinchOn = entry.value("pinch_on", gestures.pinchOn);
+            gestures.pinchOff = entry.value("pinch_off", gestures.pinchOff);
+            gestures.grabOn = entry.value("grab_on", gestures.grabOn);
+            gestures.grabOff = entry.value("grab_off", gestures.grabOff);
+            gestures.swipeSpeed = entry.value("swipe_speed", gestures.swipeSpeed);
+            gestures.tapSpeed = entry.value("tap_speed", gestures.tapSpeed);
+            gestures.tapMaxMs = entry.value("tap_max_ms", gestures.tapMaxMs);
+            setGestures(gestures);
+        }
+
+        // Load Pose library
+        if (j.contains("poses") && j["poses"].is_object()) {
+            const auto& entry = j["poses"];
+            PoseMatchConfig match = getPoseMatch();
+            match.maxDistance = entry.value("max_distance", match.maxDistance);
+            match.minMargin = entry.value("min_margin", match.minMargin);
+            setPoseMatch(match);
+            std::vector<PoseTemplate> poses;
+            if (entry.contains("library") && entry["library"].is_array()) {
+                for (const auto& item : entry["library"]) {
+                    if (!item.is_object()) continue;
+                    PoseTemplate pose;
+                    pose.id = item.value("id", 0);
+                    pose.name = item.value("name", std::string());
+                    if (item.contains("samples") && item["samples"].is_array()) {
+                        for (const auto& values : item["samples"]) {
+                            // Samples from a different feature layout can't be compared; skip them
+                            if (!values.is_array() || values.size() != POSE_FEATURES_USED) continue;
+                            PoseFeatures sample;
+                            for (size_t i = 0; i < POSE_FEATURES_USED; ++i) sample.values[i] = values[i].get<float>();
+                            pose.samples.push_back(sample);
+                        }
+                    }
+                    poses.push_back(std::move(pose));
+                }
+            }
+            setPoses(poses);
+        }
+
+        // Load Fusion settings and device extrinsics
+        FusionConfig fusion = getFusion();
+        if (j.contains("fusion") && j["fusion"].is_object()) {
+            const auto& entry = j["fusion"];
+            fusion.enabled = entry.value("enabled", fusion.enabled);
+            fusion.associationRadiusMm = entry.value("association_radius_mm", fusion.associationRadiusMm);
+            fusion.maxAgeMs = entry.value("max_age_ms", fusion.maxAgeMs);
+        }
+        if (j.contains("device_extrinsics") && j["device_extrinsics"].is_object()) {
+            fusion.extrinsics.clear();
+            for (const auto& [serial, entry] : j["device_extrinsics"].items()) {
+                if (!entry.is_array() || entry.size() != 16) continue;
+                std::array<float, 16> matrix;
+                for (size_t i = 0; i < matrix.size(); ++i) matrix[i] = entry[i].get<float>();
+                fusion.extrinsics[serial] = RigidTransform::fromMatrix(matrix);
+            }
+        }
+        setFusion(fusion);
+
+        // Load Filter Settings, one key per OSC field
         if (j.contains("booleanSettings") && j["booleanSettings"].is_object()) {
             auto& settings = j["booleanSettings"];
-            this->sendPalm_ = settings.value("sendPalm", this->sendPalm_);
-            this->sendWrist_ = settings.value("sendWrist", this->sendWrist_);
-            this->sendThumb_ = settings.value("sendThumb", this->sendThumb_);
-            this->sendIndex_ = settings.value("sendIndex", this->sendIndex_);
-            this->sendMiddle_ = settings.value("sendMiddle", this->sendMiddle_);
-            this->sendRing_ = settings.value("sendRing", this->sendRing_);
-            this->sendPinky_ = settings.value("sendPinky", this->sendPinky_);
-            this->sendPalmOrientation_ = settings.value("sendPalmOrientation", this->sendPalmOrientation_);
-            this->sendPalmVelocity_ = settings.value("sendPalmVelocity", this->sendPalmVelocity_);
-            this->sendPalmNormal_ = settings.value("sendPalmNormal", this->sendPalmNormal_);
-            this->sendVisibleTime_ = settings.value("sendVisibleTime", this->sendVisibleTime_);
-            this->sendFingerIsExtended_ = settings.value("sendFingerIsExtended", this->sendFingerIsExtended_);
-            this->sendPinchStrength_ = settings.value("sendPinchStrength", this->sendPinchStrength_);
-            this->sendGrabStrength_ = settings.value("sendGrabStrength", this->sendGrabStrength_);
+            for (const OscFieldInfo& info : oscFields()) {
+                const OscFieldMask bit = oscFieldBit(info.field);
+                if (settings.value(info.configKey, (this->oscFieldMask_ & bit) != 0)) {
+                    this->oscFieldMask_ |= bit;
+                } else {
+                    this->oscFieldMask_ &= ~bit;
+                }
+            }
         }
 
         LOG("Configuration loaded successfully from " << filename);
@@ -138,7 +289,7 @@ bool ConfigManager::saveConfigToFile(const std::string& filename) const {
     std::filesystem::path configPath(filename);
     std::filesystem::path configDir = configPath.parent_path();
     try {
-        if (!std::filesystem::exists(configDir)) {
+        if (!configDir.empty() && !std::filesystem::exists(configDir)) {
             std::filesystem::create_directories(configDir);
             LOG("Created config directory: " << configDir.string());
         }
@@ -157,22 +308,113 @@ bool ConfigManager::saveConfigToFile(const std::string& filename) const {
     j["hand_assignments"] = this->deviceHandAssignments;
     // Save Aliases
     j["device_aliases"] = deviceAliasManager.toJson()["device_aliases"];
+    // Save Thread Placement
+    json threadPlacement = json::object();
+    for (const auto& [threadName, placement] : threadPlacements_) {
+        threadPlacement[threadName] = {
+            {"core", placement.coreIndex},
+            {"policy", threadSchedPolicyToString(placement.policy)},
+            {"priority", placement.priority}
+        };
+    }
+    j["thread_placement"] = threadPlacement;
+    // Save Frame Queue settings
+    j["frame_queue_overflow_policy"] = frameOverflowPolicyToString(this->frameQueueOverflowPolicy_);
+    j["queue_stats_interval_ms"] = this->queueStatsIntervalMs_;
+    j["catch_up_threshold"] = this->catchUpThreshold_;
+    j["processing_workers"] = this->processingWorkers_;
+    j["hand_loss_hold_frames"] = this->handLossHoldFrames_;
+    j["hand_loss_hold_ms"] = this->handLossHoldMs_;
+    j["zero_bundle_repeats"] = this->zeroBundleRepeats_;
+    // Save Smoothing
+    json smoothing;
+    for (size_t g = 0; g < SMOOTHING_GROUP_COUNT; ++g) {
+        const SmoothingGroup group = static_cast<SmoothingGroup>(g);
+        const OneEuroParams& params = this->smoothing_[group];
+        smoothing[smoothingGroupKey(group)] = {
+            {"enabled", params.enabled},
+            {"min_cutoff", params.minCutoff},
+            {"beta", params.beta},
+            {"d_cutoff", params.dCutoff}
+        };
+    }
+    j["smoothing"] = smoothing;
+    // Save Prediction
+    j["prediction"] = {
+        {"mode", predictionModeToString(this->prediction_.mode)},
+        {"to_send_time", this->prediction_.toSendTime},
+        {"lookahead_ms", this->prediction_.lookaheadMs},
+        {"max_extrapolation_ms", this->prediction_.maxExtrapolationMs},
+        {"acceleration_noise", this->prediction_.accelerationNoise},
+        {"measurement_noise", this->prediction_.measurementNoise}
+    };
+    // Save Leap input mode
+    j["input"] = {
+        {"mode", inputModeToString(this->input_.mode)},
+        {"rate_hz", this->input_.rateHz},
+        {"delay_ms", this->input_.delayMs}
+    };
+    // Save Gain Curve
+    j["gain_curve"] = {
+        {"base_gain", this->baseGain_},
+        {"mid_gain", this->midGain_},
+        {"max_gain", this->maxGain_},
+        {"low_speed_threshold", this->lowSpeedThreshold_},
+        {"mid_speed_threshold", this->midSpeedThreshold_},
+        {"velocity_source", gainVelocitySourceToString(this->gainVelocitySource_)}
+    };
+    // Save Normalized Output settings
+    j["position_output"] = positionOutputToString(this->positionOutput_);
+    j["interaction_box_learn"] = this->learnInteractionBoxes_;
+    json interactionBoxes = json::object();
+    for (const auto& [serial, box] : this->interactionBoxes_) {
+        interactionBoxes[serial] = {
+            {"min", {box.min.x, box.min.y, box.min.z}},
+            {"max", {box.max.x, box.max.y, box.max.z}}
+        };
+    }
+    j["interaction_boxes"] = interactionBoxes;
+    j["skeleton_quantized"] = this->skeletonQuantized_;
+    // Save Gesture thresholds
+    j["gestures"] = {
+        {"pinch_on", this->gestures_.pinchOn},
+        {"pinch_off", this->gestures_.pinchOff},
+        {"grab_on", this->gestures_.grabOn},
+        {"grab_off", this->gestures_.grabOff},
+        {"swipe_speed", this->gestures_.swipeSpeed},
+        {"tap_speed", this->gestures_.tapSpeed},
+        {"tap_max_ms", this->gestures_.tapMaxMs}
+    };
+    // Save Pose library
+    json poseLibrary = json::array();
+    for (const PoseTemplate& pose : this->poses_) {
+        json samples = json::array();
+        for (const PoseFeatures& sample : pose.samples) {
+            samples.push_back(std::vector<float>(sample.values.begin(), sample.values.begin() + POSE_FEATURES_USED));
+        }
+        poseLibrary.push_back({ {"id", pose.id}, {"name", pose.name}, {"samples", samples} });
+    }
+    j["poses"] = {
+        {"max_distance", this->poseMatch_.maxDistance},
+        {"min_margin", this->poseMatch_.minMargin},
+        {"library", poseLibrary}
+    };
+    // Save Fusion settings and device extrinsics
+    j["fusion"] = {
+        {"enabled", this->fusion_.enabled},
+        {"association_radius_mm", this->fusion_.associationRadiusMm},
+        {"max_age_ms", this->fusion_.maxAgeMs}
+    };
+    json extrinsics = json::object();
+    for (const auto& [serial, transform] : this->fusion_.extrinsics) {
+        extrinsics[serial] = transform.toMatrix();
+    }
+    j["device_extrinsics"] = extrinsics;
     // Save Filter Settings
     json booleanSettings;
-    booleanSettings["sendPalm"] = this->sendPalm_;
-    booleanSettings["sendWrist"] = this->sendWrist_;
-    booleanSettings["sendThumb"] = this->sendThumb_;
-    booleanSettings["sendIndex"] = this->sendIndex_;
-    booleanSettings["sendMiddle"] = this->sendMiddle_;
-    booleanSettings["sendRing"] = this->sendRing_;
-    booleanSettings["sendPinky"] = this->sendPinky_;
-    booleanSettings["sendPalmOrientation"] = this->sendPalmOrientation_;
-    booleanSettings["sendPalmVelocity"] = this->sendPalmVelocity_;
-    booleanSettings["sendPalmNormal"] = this->sendPalmNormal_;
-    booleanSettings["sendVisibleTime"] = this->sendVisibleTime_;
-    booleanSettings["sendFingerIsExtended"] = this->sendFingerIsExtended_;
-    booleanSettings["sendPinchStrength"] = this->sendPinchStrength_;
-    booleanSettings["sendGrabStrength"] = this->sendGrabStrength_;
+    for (const OscFieldInfo& info : oscFields()) {
+        booleanSettings[info.configKey] = (this->oscFieldMask_ & oscFieldBit(info.field)) != 0;
+    }
     j["booleanSettings"] = booleanSettings;
 
     std::ofstream ofs(filename);
@@ -238,32 +480,122 @@ void ConfigManager::setOscPort(int port) { oscPort = port; }
 bool ConfigManager::getLowLatencyMode() const { return lowLatencyMode; }
 void ConfigManager::setLowLatencyMode(bool enabled) { lowLatencyMode = enabled; }
 
-bool ConfigManager::isSendPalmEnabled() const { return sendPalm_; }
-bool ConfigManager::isSendWristEnabled() const { return sendWrist_; }
-bool ConfigManager::isSendThumbEnabled() const { return sendThumb_; }
-bool ConfigManager::isSendIndexEnabled() const { return sendIndex_; }
-bool ConfigManager::isSendMiddleEnabled() const { return sendMiddle_; }
-bool ConfigManager::isSendRingEnabled() const { return sendRing_; }
-bool ConfigManager::isSendPinkyEnabled() const { return sendPinky_; }
-bool ConfigManager::isSendPalmOrientationEnabled() const { return sendPalmOrientation_; }
-bool ConfigManager::isSendPalmVelocityEnabled() const { return sendPalmVelocity_; }
-bool ConfigManager::isSendPalmNormalEnabled() const { return sendPalmNormal_; }
-bool ConfigManager::isSendVisibleTimeEnabled() const { return sendVisibleTime_; }
-bool ConfigManager::isSendFingerIsExtendedEnabled() const { return sendFingerIsExtended_; }
-bool ConfigManager::isSendPinchStrengthEnabled() const { return sendPinchStrength_; }
-bool ConfigManager::isSendGrabStrengthEnabled() const { return sendGrabStrength_; }
-
-void ConfigManager::setSendPalmEnabled(bool enabled) { sendPalm_ = enabled; }
-void ConfigManager::setSendWristEnabled(bool enabled) { sendWrist_ = enabled; }
-void ConfigManager::setSendThumbEnabled(bool enabled) { sendThumb_ = enabled; }
-void ConfigManager::setSendIndexEnabled(bool enabled) { sendIndex_ = enabled; }
-void ConfigManager::setSendMiddleEnabled(bool enabled) { sendMiddle_ = enabled; }
-void ConfigManager::setSendRingEnabled(bool enabled) { sendRing_ = enabled; }
-void ConfigManager::setSendPinkyEnabled(bool enabled) { sendPinky_ = enabled; }
-void ConfigManager::setSendPalmOrientationEnabled(bool enabled) { sendPalmOrientation_ = enabled; }
-void ConfigManager::setSendPalmVelocityEnabled(bool enabled) { sendPalmVelocity_ = enabled; }
-void ConfigManager::setSendPalmNormalEnabled(bool enabled) { sendPalmNormal_ = enabled; }
-void ConfigManager::setSendVisibleTimeEnabled(bool enabled) { sendVisibleTime_ = enabled; }
-void ConfigManager::setSendFingerIsExtendedEnabled(bool enabled) { sendFingerIsExtended_ = enabled; }
-void ConfigManager::setSendPinchStrengthEnabled(bool enabled) { sendPinchStrength_ = enabled; }
-void ConfigManager::setSendGrabStrengthEnabled(bool enabled) { sendGrabStrength_ = enabled; }
\ No newline at end of file
+ThreadPlacement ConfigManager::getThreadPlacement(const std::string& threadName) const {
+    auto it = threadPlacements_.find(threadName);
+    return it != threadPlacements_.end() ? it->second : ThreadPlacement{};
+}
+void ConfigManager::setThreadPlacement(const std::string& threadName, const ThreadPlacement& placement) {
+    if (placement.isDefault()) {
+        threadPlacements_.erase(threadName);
+    } else {
+        threadPlacements_[threadName] = placement;
+    }
+}
+
+FrameOverflowPolicy ConfigManager::getFrameQueueOverflowPolicy() const { return frameQueueOverflowPolicy_; }
+void ConfigManager::setFrameQueueOverflowPolicy(FrameOverflowPolicy policy) { frameQueueOverflowPolicy_ = policy; }
+int ConfigManager::getQueueStatsIntervalMs() const { return queueStatsIntervalMs_; }
+void ConfigManager::setQueueStatsIntervalMs(int intervalMs) { queueStatsIntervalMs_ = (std::max)(0, intervalMs); }
+int ConfigManager::getCatchUpThreshold() const { return catchUpThreshold_; }
+void ConfigManager::setCatchUpThreshold(int frames) { catchUpThreshold_ = (std::max)(0, frames); }
+int ConfigManager::getProcessingWorkers() const { return processingWorkers_; }
+void ConfigManager::setProcessingWorkers(int workers) {
+    // More workers than device slots would never receive a frame
+    processingWorkers_ = (std::min)((std::max)(0, workers), static_cast<int>(MAX_TRACKED_DEVICES));
+}
+int ConfigManager::getHandLossHoldFrames() const { return handLossHoldFrames_; }
+void ConfigManager::setHandLossHoldFrames(int frames) { handLossHoldFrames_ = (std::max)(0, frames); }
+int ConfigManager::getHandLossHoldMs() const { return handLossHoldMs_; }
+void ConfigManager::setHandLossHoldMs(int milliseconds) { handLossHoldMs_ = (std::max)(0, milliseconds); }
+int ConfigManager::getZeroBundleRepeats() const { return zeroBundleRepeats_; }
+void ConfigManager::setZeroBundleRepeats(int repeats) { zeroBundleRepeats_ = (std::min)((std::max)(1, repeats), 10); }
+GainCurve ConfigManager::getGainCurve() const {
+    GainCurve curve;
+    curve.baseGain = baseGain_;
+    curve.midGain = midGain_;
+    curve.maxGain = maxGain_;
+    curve.lowSpeed = lowSpeedThreshold_;
+    curve.midSpeed = midSpeedThreshold_;
+    curve.velocitySource = gainVelocitySource_;
+    return curve;
+}
+void ConfigManager::setGainCurve(const GainCurve& curve) {
+    // Range checks stay in main.cpp, which falls back to defaults as a set
+    setGainParams(curve.baseGain, curve.midGain, curve.maxGain, curve.lowSpeed, curve.midSpeed);
+    gainVelocitySource_ = curve.velocitySource;
+}
+PositionOutput ConfigManager::getPositionOutput() const { return positionOutput_; }
+void ConfigManager::setPositionOutput(PositionOutput output) { positionOutput_ = output; }
+std::map<std::string, InteractionBox> ConfigManager::getInteractionBoxes() const { return interactionBoxes_; }
+void ConfigManager::setInteractionBox(const std::string& serialNumber, const InteractionBox& box) {
+    // An empty or inverted axis can't be normalized against; keep the previous box
+    if (box.max.x <= box.min.x || box.max.y <= box.min.y || box.max.z <= box.min.z) return;
+    interactionBoxes_[serialNumber] = box;
+}
+bool ConfigManager::getSkeletonQuantized() const { return skeletonQuantized_; }
+void ConfigManager::setSkeletonQuantized(bool quantized) { skeletonQuantized_ = quantized; }
+GestureConfig ConfigManager::getGestures() const { return gestures_; }
+std::vector<PoseTemplate> ConfigManager::getPoses() const { return poses_; }
+void ConfigManager::setPoses(const std::vector<PoseTemplate>& poses) {
+    poses_.clear();
+    for (const PoseTemplate& pose : poses) {
+        // Ids are what receivers see; 0 means "no pose" and duplicates would be ambiguous
+        if (pose.id <= 0) continue;
+        const bool duplicate = std::any_of(poses_.begin(), poses_.end(), [&](const PoseTemplate& kept) { return kept.id == pose.id; });
+        if (!duplicate) poses_.push_back(pose);
+    }
+}
+PoseMatchConfig ConfigManager::getPoseMatch() const { return poseMatch_; }
+void ConfigManager::setPoseMatch(const PoseMatchConfig& match) {
+    poseMatch_.maxDistance = (std::max)(0.0f, match.maxDistance);
+    poseMatch_.minMargin = (std::min)((std::max)(0.0f, match.minMargin), 1.0f);
+}
+FusionConfig ConfigManager::getFusion() const { return fusion_; }
+void ConfigManager::setFusion(const FusionConfig& fusion) {
+    fusion_ = fusion;
+    fusion_.associationRadiusMm = (std::max)(0.0f, fusion_.associationRadiusMm);
+}
+void ConfigManager::setDeviceExtrinsic(const std::string& serialNumber, const RigidTransform& transform) {
+    fusion_.extrinsics[serialNumber] = transform;
+}
+void ConfigManager::setGestures(const GestureConfig& gestures) {
+    gestures_ = gestures;
+    // Strengths are 0-1, and an off threshold above the on one would toggle every frame
+    gestures_.pinchOn = (std::min)((std::max)(0.0f, gestures_.pinchOn), 1.0f);
+    gestures_.grabOn = (std::min)((std::max)(0.0f, gestures_.grabOn), 1.0f);
+    gestures_.pinchOff = (std::min)((std::max)(0.0f, gestures_.pinchOff), gestures_.pinchOn);
+    gestures_.grabOff = (std::min)((std::max)(0.0f, gestures_.grabOff), gestures_.grabOn);
+    gestures_.swipeSpeed = (std::max)(1.0f, gestures_.swipeSpeed);
+    gestures_.tapSpeed = (std::max)(1.0f, gestures_.tapSpeed);
+}
+bool ConfigManager::getLearnInteractionBoxes() const { return learnInteractionBoxes_; }
+void ConfigManager::setLearnInteractionBoxes(bool learn) { learnInteractionBoxes_ = learn; }
+SmoothingConfig ConfigManager::getSmoothing() const { return smoothing_; }
+void ConfigManager::setSmoothing(const SmoothingConfig& smoothing) {
+    smoothing_ = smoothing;
+    // Cutoffs must stay positive for the filter's smoothing factor to be defined
+    for (OneEuroParams& params : smoothing_.groups) {
+        params.minCutoff = (std::max)(0.001f, params.minCutoff);
+        params.dCutoff = (std::max)(0.001f, params.dCutoff);
+        params.beta = (std::max)(0.0f, params.beta);
+    }
+}
+PredictionConfig ConfigManager::getPrediction() const { return prediction_; }
+void ConfigManager::setPrediction(const PredictionConfig& prediction) {
+    prediction_ = prediction;
+    // A lookahead is only ever forward, and the Kalman gains need positive noise
+    prediction_.maxExtrapolationMs = (std::max)(0.0f, prediction_.maxExtrapolationMs);
+    prediction_.lookaheadMs = (std::min)((std::max)(0.0f, prediction_.lookaheadMs), prediction_.maxExtrapolationMs);
+    prediction_.accelerationNoise = (std::max)(0.0f, prediction_.accelerationNoise);
+    prediction_.measurementNoise = (std::max)(0.001f, prediction_.measurementNoise);
+}
+InputConfig ConfigManager::getInput() const { return input_; }
+void ConfigManager::setInput(const InputConfig& input) {
+    input_ = input;
+    // Beyond 1 kHz the ticks outrun what the poll thread can sample
+    input_.rateHz = (std::min)((std::max)(1.0f, input_.rateHz), 1000.0f);
+    input_.delayMs = (std::max)(0.0f, input_.delayMs);
+}
+
+OscFieldMask ConfigManager::getOscFieldMask() const { return oscFieldMask_; }
+void ConfigManager::setOscFieldMask(OscFieldMask fields) { oscFieldMask_ = fields; }
@@ -50,6 +50,51 @@ public:
     bool getLowLatencyMode() const override;
     void setLowLatencyMode(bool enabled) override;
 
+    // Thread placement
+    ThreadPlacement getThreadPlacement(const std::string& threadName) const override;
+    void setThreadPlacement(const std::string& threadName, const ThreadPlacement& placement) override;
+
+    // Frame queue
+    FrameOverflowPolicy getFrameQueueOverflowPolicy() const override;
+    void setFrameQueueOverflowPolicy(FrameOverflowPolicy policy) override;
+    int getQueueStatsIntervalMs() const override;
+    void setQueueStatsIntervalMs(int intervalMs) override;
+    int getCatchUpThreshold() const override;
+    void setCatchUpThreshold(int frames) override;
+    int getProcessingWorkers() const override;
+    void setProcessingWorkers(int workers) override;
+    int getHandLossHoldFrames() const override;
+    void setHandLossHoldFrames(int frames) override;
+    int getHandLossHoldMs() const override;
+    void setHandLossHoldMs(int milliseconds) override;
+    int getZeroBundleRepeats() const override;
+    void setZeroBundleRepeats(int repeats) override;
+    SmoothingConfig getSmoothing() const override;
+    void setSmoothing(const SmoothingConfig& smoothing) override;
+    PredictionConfig getPrediction() const override;
+    void setPrediction(const PredictionConfig& prediction) override;
+    InputConfig getInput() const override;
+    void setInput(const InputConfig& input) override;
+    GainCurve getGainCurve() const override;
+    void setGainCurve(const GainCurve& curve) override;
+    PositionOutput getPositionOutput() const override;
+    void setPositionOutput(PositionOutput output) override;
+    std::map<std::string, InteractionBox> getInteractionBoxes() const override;
+    void setInteractionBox(const std::string& serialNumber, const InteractionBox& box) override;
+    bool getLearnInteractionBoxes() const override;
+    void setLearnInteractionBoxes(bool learn) override;
+    bool getSkeletonQuantized() const override;
+    void setSkeletonQuantized(bool quantized) override;
+    GestureConfig getGestures() const override;
+    void setGestures(const GestureConfig& gestures) override;
+    std::vector<PoseTemplate> getPoses() const override;
+    void setPoses(const std::vector<PoseTemplate>& poses) override;
+    PoseMatchConfig getPoseMatch() const override;
+    void setPoseMatch(const PoseMatchConfig& match) override;
+    FusionConfig getFusion() const override;
+    void setFusion(const FusionConfig& fusion) override;
+    void setDeviceExtrinsic(const std::string& serialNumber, const RigidTransform& transform) override;
+
     // Hand Assignments
     std::string getDefaultHandAssignment(const std::string& serialNumber) const override;
     void setDefaultHandAssignment(const std::string& serialNumber, const std::string& handType) override;
@@ -60,37 +105,9 @@ public:
     DeviceAliasManager& getDeviceAliasManager() override;
     const DeviceAliasManager& getDeviceAliasManager() const override;
 
-    // Feature flags (getters)
-    bool isSendPalmEnabled() const override;
-    bool isSendWristEnabled() const override;
-    bool isSendThumbEnabled() const override;
-    bool isSendIndexEnabled() const override;
-    bool isSendMiddleEnabled() const override;
-    bool isSendRingEnabled() const override;
-    bool isSendPinkyEnabled() const override;
-    bool isSendPalmOrientationEnabled() const override;
-    bool isSendPalmVelocityEnabled() const override;
-    bool isSendPalmNormalEnabled() const override;
-    bool isSendVisibleTimeEnabled() const override;
-    bool isSendFingerIsExtendedEnabled() const override;
-    bool isSendPinchStrengthEnabled() const override;
-    bool isSendGrabStrengthEnabled() const override;
-
-    // Feature flags (setters)
-    void setSendPalmEnabled(bool enabled) override;
-    void setSendWristEnabled(bool enabled) override;
-    void setSendThumbEnabled(bool enabled) override;
-    void setSendIndexEnabled(bool enabled) override;
-    void setSendMiddleEnabled(bool enabled) override;
-    void setSendRingEnabled(bool enabled) override;
-    void setSendPinkyEnabled(bool enabled) override;
-    void setSendPalmOrientationEnabled(bool enabled) override;
-    void setSendPalmVelocityEnabled(bool enabled) override;
-    void setSendPalmNormalEnabled(bool enabled) override;
-    void setSendVisibleTimeEnabled(bool enabled) override;
-    void setSendFingerIsExtendedEnabled(bool enabled) override;
-    void setSendPinchStrengthEnabled(bool enabled) override;
-    void setSendGrabStrengthEnabled(bool enabled) override;
+    // OSC output fields
+    OscFieldMask getOscFieldMask() const override;
+    void setOscFieldMask(OscFieldMask fields) override;
 
 private:
     // Gain curve members (KEEP THESE)
@@ -99,29 +116,34 @@ private:
     float maxGain_ = 6.0f;
     float lowSpeedThreshold_ = 80.0f; 
     float midSpeedThreshold_ = 240.0f;
+    GainVelocitySource gainVelocitySource_ = GainVelocitySource::Palm;
     // Configuration storage
     std::string oscIp;
     int oscPort;
     bool lowLatencyMode;
     std::map<std::string, std::string> deviceHandAssignments;
-    
-    // Explicit boolean members for filters
-    bool sendPalm_;
-    bool sendWrist_;
-    bool sendThumb_;
-    bool sendIndex_;
-    bool sendMiddle_;
-    bool sendRing_;
-    bool sendPinky_;
-    bool sendPalmOrientation_;
-    bool sendPalmVelocity_;
-    bool sendPalmNormal_;
-    bool sendVisibleTime_;
-    bool sendFingerIsExtended_;
-
-    // Add members for pinch/grab
-    bool sendPinchStrength_;
-    bool sendGrabStrength_;
+    std::map<std::string, ThreadPlacement> threadPlacements_;
+    FrameOverflowPolicy frameQueueOverflowPolicy_ = FrameOverflowPolicy::DropNewest;
+    int queueStatsIntervalMs_ = 1000;
+    int catchUpThreshold_ = 32;
+    int processingWorkers_ = 0;
+    int handLossHoldFrames_ = 3;
+    int handLossHoldMs_ = 0;
+    int zeroBundleRepeats_ = 1;
+    SmoothingConfig smoothing_;
+    PredictionConfig prediction_;
+    InputConfig input_;
+    PositionOutput positionOutput_ = PositionOutput::Raw;
+    std::map<std::string, InteractionBox> interactionBoxes_;
+    bool learnInteractionBoxes_ = false;
+    bool skeletonQuantized_ = false;
+    GestureConfig gestures_;
+    std::vector<PoseTemplate> poses_;
+    PoseMatchConfig poseMatch_;
+    FusionConfig fusion_; // Extrinsics saved as "device_extrinsics"
+
+    // Enabled OSC fields, saved as "booleanSettings"
+    OscFieldMask oscFieldMask_ = defaultOscFieldMask();
 
     // Serial-to-alias mapping
     DeviceAliasManager deviceAliasManager;
@@ -0,0 +1,27 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include "HandData.hpp"
+#include "HandPoints.hpp"
+
+// Values DataProcessor computes per hand rather than reads from the tracker.
+// OSC channels with OscSource::Derived read from here the way the others read
+// from HandData, so derived values go through the same emission plan.
+
+struct DerivedHandData {
+    // Relative cursor per point, 0-1 on each axis of the interaction box
+    std::array<Vector3, HAND_POINT_COUNT> cursor;
+    // Position per point mapped from its device's interaction box to 0-1
+    std::array<Vector3, HAND_POINT_COUNT> normalized;
+
+    // Biomechanics (see HandFeatures.hpp), fingers thumb..pinky
+    std::array<std::array<float, 3>, 5> flexion; // Degrees at MCP, PIP, DIP
+    std::array<float, 5> curl;                   // 0 straight - 1 fully curled
+    std::array<float, 4> spread;                 // Degrees between thumb-index, index-middle, middle-ring, ring-pinky
+    float palmRoll, palmPitch, palmYaw;          // Degrees
+    float openness;                              // 0 fist - 1 flat hand
+
+    // Static pose (see PoseClassifier.hpp), sent as floats
+    float poseId;                                // 0 = none
+    float poseScore;                             // 0-1
+};
@@ -32,6 +32,7 @@ void DeviceAliasManager::validateAlias(const std::string& alias) {
 }
 
 std::string DeviceAliasManager::getOrAssignAlias(const std::string& serial) {
+    if (serial == FUSED_DEVICE_ID) return serial;
     std::lock_guard<std::mutex> lock(mutex_);
     auto it = serialToAlias_.find(serial);
     if (it != serialToAlias_.end()) {
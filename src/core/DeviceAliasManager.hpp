@@ -17,6 +17,10 @@ enum class AssignedHand {
     Both
 };
 
+// Device id of the fused stream (see HandFusion). Its alias is always "fused",
+// so it is sent as /leap/fused/... and never takes a devN alias.
+constexpr const char* FUSED_DEVICE_ID = "fused";
+
 class DeviceAliasManager {
 public:
     /**
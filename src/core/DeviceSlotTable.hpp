@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include "FrameData.hpp"
+#include "FrameSnapshot.hpp"
+
+// Maps device serials to small fixed indices ("device slots") so per-device
+// state can live in plain arrays instead of maps.
+//
+// One writer thread assigns slots on first sight of a serial; slots are never
+// reused. Any thread may look slots up: a slot's id is written before the
+// published count is raised past it, so readers need no lock.
+class DeviceSlotTable {
+public:
+    DeviceSlotTable() = default;
+    DeviceSlotTable(const DeviceSlotTable&) = delete;
+    DeviceSlotTable& operator=(const DeviceSlotTable&) = delete;
+
+    // Writer only. Returns INVALID_DEVICE_SLOT once MAX_TRACKED_DEVICES are taken.
+    uint8_t findOrAssign(const std::string& deviceId) {
+        uint8_t slot = find(deviceId);
+        if (slot != INVALID_DEVICE_SLOT) return slot;
+        const size_t count = count_.load(std::memory_order_relaxed);
+        if (count >= MAX_TRACKED_DEVICES) return INVALID_DEVICE_SLOT;
+        copyToFixed(ids_[count], deviceId);
+        count_.store(count + 1, std::memory_order_release);
+        return static_cast<uint8_t>(count);
+    }
+
+    uint8_t find(const std::string& deviceId) const {
+        const size_t count = count_.load(std::memory_order_acquire);
+        const size_t len = deviceId.size() < SNAPSHOT_ID_LENGTH - 1 ? deviceId.size() : SNAPSHOT_ID_LENGTH - 1;
+        for (size_t i = 0; i < count; ++i) {
+            // Compare the way copyToFixed() truncates, so over-long ids still map to one slot
+            if (std::strlen(ids_[i]) == len && std::memcmp(ids_[i], deviceId.data(), len) == 0) {
+                return static_cast<uint8_t>(i);
+            }
+        }
+        return INVALID_DEVICE_SLOT;
+    }
+
+    size_t size() const { return count_.load(std::memory_order_acquire); }
+
+    // Valid for slot < size().
+    const char* idAt(size_t slot) const { return ids_[slot]; }
+
+private:
+    char ids_[MAX_TRACKED_DEVICES][SNAPSHOT_ID_LENGTH] = {};
+    std::atomic<size_t> count_{0};
+};
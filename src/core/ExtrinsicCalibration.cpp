@@ -0,0 +1,310 @@
+#include "ExtrinsicCalibration.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include "../utils/ThreadAffinity.h"
+
+namespace {
+constexpr size_t MIN_PAIRS = 3;
+constexpr int MAX_SWEEPS = 30;
+
+using Vec3d = std::array<double, 3>;
+
+double dot(const Vec3d& a, const Vec3d& b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+
+Vec3d cross(const Vec3d& a, const Vec3d& b) {
+    return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+}
+
+double determinant(const std::array<Vec3d, 3>& columns) { return dot(columns[0], cross(columns[1], columns[2])); }
+
+// Thin SVD of a 3x3 matrix by one-sided Jacobi: rotates pairs of columns of
+// a until they are orthogonal, accumulating the rotations in v. Afterwards
+// a = U * S (column k is s_k * u_k) and the input equals a * v^T. Columns are
+// sorted by decreasing singular value.
+void jacobiSvd(std::array<Vec3d, 3>& a, std::array<Vec3d, 3>& v, Vec3d& s) {
+    v = { Vec3d{ 1, 0, 0 }, Vec3d{ 0, 1, 0 }, Vec3d{ 0, 0, 1 } };
+    for (int sweep = 0; sweep < MAX_SWEEPS; ++sweep) {
+        bool rotated = false;
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = i + 1; j < 3; ++j) {
+                const double alpha = dot(a[i], a[i]);
+                const double beta = dot(a[j], a[j]);
+                const double gamma = dot(a[i], a[j]);
+                if (std::abs(gamma) <= 1e-15 * std::sqrt(alpha * beta)) continue;
+                rotated = true;
+                const double zeta = (beta - alpha) / (2.0 * gamma);
+                const double t = (zeta >= 0 ? 1.0 : -1.0) / (std::abs(zeta) + std::sqrt(1.0 + zeta * zeta));
+                const double c = 1.0 / std::sqrt(1.0 + t * t);
+                const double sn = c * t;
+                for (size_t r = 0; r < 3; ++r) {
+                    const double ai = a[i][r], aj = a[j][r];
+                    a[i][r] = c * ai - sn * aj;
+                    a[j][r] = sn * ai + c * aj;
+                    const double vi = v[i][r], vj = v[j][r];
+                    v[i][r] = c * vi - sn * vj;
+                    v[j][r] = sn * vi + c * vj;
+                }
+            }
+        }
+        if (!rotated) break;
+    }
+    for (size_t k = 0; k < 3; ++k) s[k] = std::sqrt(dot(a[k], a[k]));
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = i + 1; j < 3; ++j) {
+            if (s[j] > s[i]) {
+                std::swap(s[i], s[j]);
+                std::swap(a[i], a[j]);
+                std::swap(v[i], v[j]);
+            }
+        }
+    }
+}
+
+float squaredError(const RigidTransform& transform, const PointPair& pair) {
+    const Vector3 p = transform.applyToPoint(pair.device);
+    const float dx = p.x - pair.reference.x, dy = p.y - pair.reference.y, dz = p.z - pair.reference.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+size_t collectInliers(const std::vector<PointPair>& pairs, const RigidTransform& transform, float threshold,
+                      std::vector<PointPair>* inliers) {
+    const float limit = threshold * threshold;
+    size_t count = 0;
+    if (inliers) inliers->clear();
+    for (const PointPair& pair : pairs) {
+        if (squaredError(transform, pair) > limit) continue;
+        ++count;
+        if (inliers) inliers->push_back(pair);
+    }
+    return count;
+}
+
+float distance(const Vector3& a, const Vector3& b) {
+    const float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+}
+
+bool solveRigidTransform(const PointPair* pairs, size_t count, RigidTransform& out) {
+    if (count < MIN_PAIRS) return false;
+    Vec3d deviceCentroid{}, referenceCentroid{};
+    for (size_t i = 0; i < count; ++i) {
+        deviceCentroid[0] += pairs[i].device.x;
+        deviceCentroid[1] += pairs[i].device.y;
+        deviceCentroid[2] += pairs[i].device.z;
+        referenceCentroid[0] += pairs[i].reference.x;
+        referenceCentroid[1] += pairs[i].reference.y;
+        referenceCentroid[2] += pairs[i].reference.z;
+    }
+    for (size_t k = 0; k < 3; ++k) {
+        deviceCentroid[k] /= static_cast<double>(count);
+        referenceCentroid[k] /= static_cast<double>(count);
+    }
+
+    // Cross-covariance H = sum (p - p0)(q - q0)^T, stored by column
+    std::array<Vec3d, 3> h{};
+    for (size_t i = 0; i < count; ++i) {
+        const Vec3d p{ pairs[i].device.x - deviceCentroid[0], pairs[i].device.y - deviceCentroid[1],
+                       pairs[i].device.z - deviceCentroid[2] };
+        const Vec3d q{ pairs[i].reference.x - referenceCentroid[0], pairs[i].reference.y - referenceCentroid[1],
+                       pairs[i].reference.z - referenceCentroid[2] };
+        for (size_t c = 0; c < 3; ++c) {
+            for (size_t r = 0; r < 3; ++r) h[c][r] += p[r] * q[c];
+        }
+    }
+
+    std::array<Vec3d, 3> v;
+    Vec3d s;
+    jacobiSvd(h, v, s);
+    // Points on a line (or all in one place) leave the rotation about it open
+    if (s[0] <= 0.0 || s[1] <= 1e-6 * s[0]) return false;
+    std::array<Vec3d, 3> u;
+    for (size_t k = 0; k < 2; ++k) {
+        for (size_t r = 0; r < 3; ++r) u[k][r] = h[k][r] / s[k];
+    }
+    if (s[2] > 1e-6 * s[0]) {
+        for (size_t r = 0; r < 3; ++r) u[2][r] = h[2][r] / s[2];
+    } else {
+        u[2] = cross(u[0], u[1]); // Planar points: the third direction is free
+    }
+
+    // R = V * diag(1, 1, d) * U^T, with d flipping a reflection into a rotation
+    const double d = determinant(u) * determinant(v) < 0.0 ? -1.0 : 1.0;
+    const Vec3d scale{ 1.0, 1.0, d };
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            double sum = 0.0;
+            for (size_t k = 0; k < 3; ++k) sum += v[k][i] * scale[k] * u[k][j];
+            out.rotation[i * 3 + j] = static_cast<float>(sum);
+        }
+    }
+    const Vector3 centroid{ static_cast<float>(deviceCentroid[0]), static_cast<float>(deviceCentroid[1]),
+                            static_cast<float>(deviceCentroid[2]) };
+    const Vector3 rotated = out.applyToDirection(centroid);
+    out.translation = { static_cast<float>(referenceCentroid[0]) - rotated.x,
+                        static_cast<float>(referenceCentroid[1]) - rotated.y,
+                        static_cast<float>(referenceCentroid[2]) - rotated.z };
+    return true;
+}
+
+CalibrationResult solveRigidTransformRansac(const std::vector<PointPair>& pairs,
+                                            const CalibrationConfig& config,
+                                            uint32_t seed) {
+    CalibrationResult result;
+    result.pairs = pairs.size();
+    if (pairs.size() < MIN_PAIRS) return result;
+
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<size_t> pick(0, pairs.size() - 1);
+    RigidTransform best;
+    size_t bestCount = 0;
+    for (uint32_t iteration = 0; iteration < config.ransacIterations; ++iteration) {
+        std::array<PointPair, MIN_PAIRS> sample;
+        std::array<size_t, MIN_PAIRS> picked;
+        for (size_t k = 0; k < MIN_PAIRS; ++k) {
+            do {
+                picked[k] = pick(random);
+            } while (std::find(picked.begin(), picked.begin() + k, picked[k]) != picked.begin() + k);
+            sample[k] = pairs[picked[k]];
+        }
+        RigidTransform candidate;
+        if (!solveRigidTransform(sample.data(), sample.size(), candidate)) continue;
+        const size_t count = collectInliers(pairs, candidate, config.inlierThresholdMm, nullptr);
+        if (count > bestCount) {
+            bestCount = count;
+            best = candidate;
+        }
+    }
+    if (bestCount < MIN_PAIRS) return result;
+
+    // Refit on the consensus set twice: the first refit can win back a few pairs
+    std::vector<PointPair> inliers;
+    inliers.reserve(bestCount);
+    for (int pass = 0; pass < 2; ++pass) {
+        collectInliers(pairs, best, config.inlierThresholdMm, &inliers);
+        RigidTransform refit;
+        if (!solveRigidTransform(inliers.data(), inliers.size(), refit)) break;
+        best = refit;
+    }
+    collectInliers(pairs, best, config.inlierThresholdMm, &inliers);
+    if (inliers.size() < MIN_PAIRS) return result;
+
+    double sum = 0.0;
+    for (const PointPair& pair : inliers) sum += squaredError(best, pair);
+    result.solved = true;
+    result.transform = best;
+    result.inliers = inliers.size();
+    result.rmsErrorMm = static_cast<float>(std::sqrt(sum / static_cast<double>(inliers.size())));
+    return result;
+}
+
+ExtrinsicCalibrator::ExtrinsicCalibrator(const CalibrationConfig& config)
+    : config_(config)
+{}
+
+ExtrinsicCalibrator::~ExtrinsicCalibrator() { join(); }
+
+void ExtrinsicCalibrator::join() {
+    if (worker_.joinable()) worker_.join();
+}
+
+void ExtrinsicCalibrator::start() {
+    if (solving_) return;
+    cancel();
+    collecting_ = true;
+}
+
+void ExtrinsicCalibrator::cancel() {
+    collecting_ = false;
+    reference_.clear();
+    referenceSlot_ = INVALID_DEVICE_SLOT;
+    latest_.fill(Latest());
+    collected_.clear();
+}
+
+void ExtrinsicCalibrator::addFrame(const FrameData& frame) {
+    if (!collecting_ || frame.deviceSlot >= MAX_TRACKED_DEVICES) return;
+    const uint8_t slot = frame.deviceSlot;
+    Latest& latest = latest_[slot];
+    latest.valid = false;
+    // One hand each, so there is no question which hands correspond
+    if (frame.deviceLost || frame.hands.size() != 1 || !frame.hands[0].isValid()) return;
+
+    const HandData& hand = frame.hands[0];
+    latest.valid = true;
+    latest.handType = hand.handType;
+    latest.timestampUs = frame.timestamp;
+    latest.points[0] = hand.palm.position;
+    for (size_t f = 0; f < hand.fingers.size(); ++f) latest.points[1 + f] = hand.fingers[f].bones[3].nextJoint;
+    if (serials_[slot] != frame.deviceId) serials_[slot] = frame.deviceId;
+
+    if (reference_.empty()) {
+        reference_ = frame.deviceId;
+        referenceSlot_ = slot;
+    }
+    if (slot == referenceSlot_) {
+        for (size_t other = 0; other < MAX_TRACKED_DEVICES; ++other) {
+            if (other != slot && latest_[other].valid) pair(latest, serials_[other], latest_[other]);
+        }
+    } else if (latest_[referenceSlot_].valid) {
+        pair(latest_[referenceSlot_], frame.deviceId, latest);
+    }
+}
+
+void ExtrinsicCalibrator::pair(const Latest& reference, const std::string& serial, const Latest& device) {
+    if (reference.handType != device.handType) return;
+    const uint64_t skew = reference.timestampUs > device.timestampUs ? reference.timestampUs - device.timestampUs
+                                                                     : device.timestampUs - reference.timestampUs;
+    if (skew > config_.maxSkewUs) return;
+
+    Collected& collected = collected_[serial];
+    if (collected.pairs.size() >= config_.maxSamples * POINTS_PER_SAMPLE) return;
+    // A hand held still would otherwise fill the buffer with one pose
+    if (!collected.pairs.empty() && distance(reference.points[0], collected.lastPalm) < config_.minSpacingMm) return;
+    if (collected.pairs.empty()) collected.pairs.reserve(config_.maxSamples * POINTS_PER_SAMPLE);
+    for (size_t i = 0; i < POINTS_PER_SAMPLE; ++i) collected.pairs.push_back({ reference.points[i], device.points[i] });
+    collected.lastPalm = reference.points[0];
+}
+
+bool ExtrinsicCalibrator::solve() {
+    if (solving_ || collected_.empty()) return false;
+    collecting_ = false;
+    join(); // A previous solve whose results were never taken
+
+    std::vector<std::pair<std::string, std::vector<PointPair>>> jobs;
+    for (auto& [serial, collected] : collected_) jobs.emplace_back(serial, std::move(collected.pairs));
+    collected_.clear();
+
+    finished_.store(false);
+    solving_.store(true);
+    worker_ = std::thread([this, jobs = std::move(jobs), config = config_, placement = threadPlacement_]() {
+        threadPlacementReport_ = ThreadAffinity::applyPlacementToCurrentThread(ThreadNames::Calibration, placement);
+        std::vector<CalibrationResult> results;
+        for (const auto& [serial, pairs] : jobs) {
+            CalibrationResult result = solveRigidTransformRansac(pairs, config);
+            result.serial = serial;
+            results.push_back(std::move(result));
+        }
+        results_ = std::move(results);
+        finished_.store(true, std::memory_order_release);
+    });
+    return true;
+}
+
+bool ExtrinsicCalibrator::takeResults(std::vector<CalibrationResult>& results) {
+    if (!finished_.load(std::memory_order_acquire)) return false;
+    join();
+    results = std::move(results_);
+    results_.clear();
+    finished_.store(false);
+    solving_.store(false);
+    return true;
+}
+
+std::map<std::string, size_t> ExtrinsicCalibrator::sampleCounts() const {
+    std::map<std::string, size_t> counts;
+    for (const auto& [serial, collected] : collected_) counts[serial] = collected.pairs.size() / POINTS_PER_SAMPLE;
+    return counts;
+}
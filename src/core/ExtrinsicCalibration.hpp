@@ -0,0 +1,124 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "FrameData.hpp"
+#include "HandFusion.hpp"
+#include "../utils/ThreadPlacement.h"
+
+// Extrinsic calibration between devices: the rigid transform taking each
+// device's coordinates to those of a reference device, found from one hand
+// that both see at the same time.
+
+// One point seen by the reference device and by the device being calibrated.
+struct PointPair {
+    Vector3 reference;
+    Vector3 device;
+};
+
+struct CalibrationConfig {
+    uint32_t maxSkewUs = 5000;       // Frames of two devices closer than this are simultaneous
+    float minSpacingMm = 15.0f;      // The palm must move this far between two samples
+    size_t maxSamples = 500;         // Per device; collection for it stops there
+    uint32_t ransacIterations = 256;
+    float inlierThresholdMm = 12.0f; // Pairs farther apart than this after the transform are outliers
+};
+
+struct CalibrationResult {
+    std::string serial;        // The calibrated device
+    bool solved = false;
+    RigidTransform transform;  // Its coordinates -> the reference device's
+    float rmsErrorMm = 0.0f;   // Residual over the inliers
+    size_t inliers = 0;
+    size_t pairs = 0;
+};
+
+// Least-squares rigid transform taking every pair's device point onto its
+// reference point (Kabsch: SVD of the cross-covariance, with the reflection
+// case folded back into a rotation). False for fewer than three pairs or
+// collinear points.
+bool solveRigidTransform(const PointPair* pairs, size_t count, RigidTransform& out);
+
+// RANSAC around solveRigidTransform: fits random triples, keeps the model
+// with the most pairs within inlierThresholdMm and refits it on those.
+// Deterministic for a given seed.
+CalibrationResult solveRigidTransformRansac(const std::vector<PointPair>& pairs,
+                                            const CalibrationConfig& config,
+                                            uint32_t seed = 1);
+
+// Calibration mode. While collecting, addFrame() pairs up frames from two
+// devices that each see exactly one hand of the same type within maxSkewUs:
+// the palm and the five fingertips give six point pairs per sample. The
+// reference is the first device to see a hand. solve() hands the pairs to a
+// background thread, and takeResults() returns one result per device once
+// it has finished.
+//
+// Everything but the background solve runs on one thread (the main loop).
+class ExtrinsicCalibrator {
+public:
+    static constexpr size_t POINTS_PER_SAMPLE = 6;
+
+    explicit ExtrinsicCalibrator(const CalibrationConfig& config = CalibrationConfig());
+    ~ExtrinsicCalibrator();
+
+    ExtrinsicCalibrator(const ExtrinsicCalibrator&) = delete;
+    ExtrinsicCalibrator& operator=(const ExtrinsicCalibrator&) = delete;
+
+    // Clears everything collected and starts collecting. Ignored while solving.
+    void start();
+    // Stops collecting and drops what was collected.
+    void cancel();
+    void addFrame(const FrameData& frame);
+
+    // Stops collecting and starts the background solve. False when nothing was collected.
+    bool solve();
+    bool takeResults(std::vector<CalibrationResult>& results);
+
+    // Placement for the solve thread, named ThreadNames::Calibration; applied
+    // by each solve as it starts. The report is that of the last solve and is
+    // complete once takeResults() has returned true.
+    void setThreadPlacement(const ThreadPlacement& placement) { threadPlacement_ = placement; }
+    const std::string& getThreadPlacementReport() const { return threadPlacementReport_; }
+
+    bool isCollecting() const { return collecting_; }
+    bool isSolving() const { return solving_; }
+    const std::string& referenceSerial() const { return reference_; }
+    // Samples collected so far, by device
+    std::map<std::string, size_t> sampleCounts() const;
+
+private:
+    struct Latest {
+        bool valid = false;
+        HandType handType = HandType::Left;
+        uint64_t timestampUs = 0;
+        std::array<Vector3, POINTS_PER_SAMPLE> points{};
+    };
+    struct Collected {
+        std::vector<PointPair> pairs;
+        Vector3 lastPalm;
+    };
+
+    void pair(const Latest& reference, const std::string& serial, const Latest& device);
+    void join();
+
+    CalibrationConfig config_;
+    bool collecting_ = false;
+    std::string reference_;
+    uint8_t referenceSlot_ = INVALID_DEVICE_SLOT;
+    std::array<Latest, MAX_TRACKED_DEVICES> latest_{};
+    std::array<std::string, MAX_TRACKED_DEVICES> serials_;
+    std::map<std::string, Collected> collected_;
+
+    std::thread worker_;
+    std::atomic<bool> solving_{false};
+    std::atomic<bool> finished_{false};
+    std::vector<CalibrationResult> results_; // Written by worker_ before finished_ is set
+    ThreadPlacement threadPlacement_;
+    std::string threadPlacementReport_;      // Likewise
+};
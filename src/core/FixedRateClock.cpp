@@ -0,0 +1,66 @@
+#include "FixedRateClock.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+const char* inputModeToString(InputMode mode) {
+    return mode == InputMode::Interpolated ? "interpolated" : "events";
+}
+
+InputMode inputModeFromString(const std::string& text) {
+    return text == "interpolated" ? InputMode::Interpolated : InputMode::Events;
+}
+
+FixedRateClock::FixedRateClock(double rateHz, int64_t spinNs)
+    : periodNs_(1e9 / (std::max)(rateHz, 1.0))
+    , spinNs_((std::max)(spinNs, int64_t(0))) {
+}
+
+int64_t FixedRateClock::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void FixedRateClock::reset(int64_t startNs) {
+    startNs_ = startNs;
+    nextTick_ = 0;
+    skipped_ = 0;
+}
+
+int64_t FixedRateClock::tickTime(uint64_t index) const {
+    return startNs_ + static_cast<int64_t>(std::llround(static_cast<double>(index) * periodNs_));
+}
+
+int64_t FixedRateClock::advance(int64_t nowNs) {
+    uint64_t tick = nextTick_;
+    if (nowNs > startNs_) {
+        const uint64_t latestDue = static_cast<uint64_t>(static_cast<double>(nowNs - startNs_) / periodNs_);
+        if (latestDue > tick) {
+            // Guard the float division against landing one tick past nowNs
+            const uint64_t due = tickTime(latestDue) <= nowNs ? latestDue : latestDue - 1;
+            if (due > tick) {
+                skipped_ += due - tick;
+                tick = due;
+            }
+        }
+    }
+    nextTick_ = tick + 1;
+    return tickTime(tick);
+}
+
+int64_t FixedRateClock::wait() {
+    const int64_t target = nextTickNs();
+    int64_t current = now();
+    if (target - current > spinNs_) {
+        // Sleep granularity is coarse (a timer tick on Windows), so wake early
+        // and spin the rest of the way.
+        std::this_thread::sleep_for(std::chrono::nanoseconds(target - current - spinNs_));
+        current = now();
+    }
+    while (current < target) {
+        std::this_thread::yield();
+        current = now();
+    }
+    return advance(current);
+}
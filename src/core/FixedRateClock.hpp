@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Fixed-rate input: instead of forwarding frames as tracking events arrive,
+// each device is sampled through LeapC's frame interpolation at evenly spaced
+// output ticks, for receivers that want a steady rate (audio-rate
+// controllers, fixed-step simulations).
+
+enum class InputMode : uint8_t { Events, Interpolated };
+
+const char* inputModeToString(InputMode mode); // "events", "interpolated"
+InputMode inputModeFromString(const std::string& text); // Unknown text is Events
+
+struct InputConfig {
+    InputMode mode = InputMode::Events;
+    float rateHz = 120.0f; // Interpolated: output ticks per second
+    float delayMs = 10.0f; // Interpolated: how far behind now each tick samples, so
+                           // the service has frames on both sides to interpolate between
+};
+
+// Tick schedule for the interpolated input. Tick k falls at start + k periods,
+// computed from the start rather than accumulated, so rounding never drifts.
+// A caller that falls more than a period behind skips the ticks it missed
+// instead of bursting through them. Times are steady-clock nanoseconds.
+class FixedRateClock {
+public:
+    explicit FixedRateClock(double rateHz = 120.0, int64_t spinNs = 2'000'000);
+
+    static int64_t now(); // std::chrono::steady_clock, in nanoseconds
+
+    // Makes startNs tick 0, the next one due.
+    void reset(int64_t startNs);
+
+    // The tick due next and its index.
+    int64_t nextTickNs() const { return tickTime(nextTick_); }
+    uint64_t nextTickIndex() const { return nextTick_; }
+
+    // Takes the due tick, as of nowNs, and returns its time. If later ticks
+    // are already due, the latest of them is taken and the ones before it
+    // are counted as skipped.
+    int64_t advance(int64_t nowNs);
+
+    // Blocks until the next tick (sleeping, then spinning for the last
+    // spinNs for precision) and takes it.
+    int64_t wait();
+
+    double periodNs() const { return periodNs_; }
+    uint64_t skippedTicks() const { return skipped_; }
+
+private:
+    int64_t tickTime(uint64_t index) const;
+
+    double periodNs_;
+    int64_t spinNs_;
+    int64_t startNs_ = 0;
+    uint64_t nextTick_ = 0;
+    uint64_t skipped_ = 0;
+};
@@ -0,0 +1,110 @@
+#include "FrameChannel.hpp"
+
+namespace {
+void raiseTo(std::atomic<uint32_t>& highWater, uint32_t value) {
+    uint32_t current = highWater.load(std::memory_order_relaxed);
+    while (value > current && !highWater.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+}
+
+FrameChannel::FrameChannel(size_t capacity, FrameOverflowPolicy policy)
+    : policy_(policy)
+    , pool_(capacity, [](FrameData& frame) { frame.hands.reserve(MAX_HANDS_PER_FRAME); })
+{
+    for (auto& mailbox : mailboxes_) mailbox.store(nullptr, std::memory_order_relaxed);
+}
+
+bool FrameChannel::publish(const FrameData& frame) {
+    const uint8_t slot = deviceSlots_.findOrAssign(frame.deviceId);
+
+    FrameData* target = spare_;
+    spare_ = nullptr;
+    if (!target) target = pool_.acquire();
+    if (!target && policy_ == FrameOverflowPolicy::DropOldest) {
+        target = pool_.reclaimOldest();
+        if (target) {
+            countTaken(target->deviceSlot);
+            countDropped(target->deviceSlot);
+        }
+    }
+    if (!target) {
+        countDropped(slot);
+        return false;
+    }
+
+    // Copy-assignment reuses the pooled frame's vector capacity.
+    *target = frame;
+    target->deviceSlot = slot;
+    // Counted before the frame becomes visible, so the consumer never decrements first.
+    countQueued(slot);
+
+    if (policy_ == FrameOverflowPolicy::CoalesceLatest && slot != INVALID_DEVICE_SLOT) {
+        FrameData* evicted = mailboxes_[slot].exchange(target, std::memory_order_acq_rel);
+        if (evicted) {
+            countTaken(slot);
+            countDropped(slot);
+            spare_ = evicted;
+        }
+    } else {
+        // Devices without a slot always go through the ordered ring.
+        pool_.publish(target);
+    }
+    updateHighWater(slot);
+    return true;
+}
+
+FrameData* FrameChannel::receive() {
+    FrameData* frame = pool_.receive();
+    if (!frame && policy_ == FrameOverflowPolicy::CoalesceLatest) {
+        frame = receiveCoalesced();
+    }
+    if (frame) countTaken(frame->deviceSlot);
+    return frame;
+}
+
+FrameData* FrameChannel::receiveCoalesced() {
+    const size_t count = deviceSlots_.size();
+    for (size_t i = 0; i < count; ++i) {
+        const size_t slot = (nextMailbox_ + i) % count;
+        if (FrameData* frame = mailboxes_[slot].exchange(nullptr, std::memory_order_acq_rel)) {
+            nextMailbox_ = slot + 1;
+            return frame;
+        }
+    }
+    return nullptr;
+}
+
+FrameChannel::DeviceStats FrameChannel::getDeviceStats(size_t slot) const {
+    DeviceStats stats;
+    if (slot >= MAX_TRACKED_DEVICES) return stats;
+    const SlotCounters& counters = counters_[slot];
+    stats.dropped = counters.dropped.load(std::memory_order_relaxed);
+    stats.pending = counters.pending.load(std::memory_order_relaxed);
+    stats.highWater = counters.highWater.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void FrameChannel::countQueued(uint8_t slot) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    if (slot == INVALID_DEVICE_SLOT) return;
+    counters_[slot].pending.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameChannel::updateHighWater(uint8_t slot) {
+    raiseTo(highWater_, pending_.load(std::memory_order_relaxed));
+    if (slot == INVALID_DEVICE_SLOT) return;
+    SlotCounters& counters = counters_[slot];
+    raiseTo(counters.highWater, counters.pending.load(std::memory_order_relaxed));
+}
+
+void FrameChannel::countTaken(uint8_t slot) {
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    if (slot == INVALID_DEVICE_SLOT) return;
+    counters_[slot].pending.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void FrameChannel::countDropped(uint8_t slot) {
+    totalDropped_.fetch_add(1, std::memory_order_relaxed);
+    if (slot == INVALID_DEVICE_SLOT) return;
+    counters_[slot].dropped.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "FrameData.hpp"
+#include "FrameOverflowPolicy.hpp"
+#include "DeviceSlotTable.hpp"
+#include "../utils/ObjectPool.h"
+
+// Carries tracking frames from the poll thread (producer) to the main loop
+// (consumer) through a pool of recycled FrameData, applying the configured
+// FrameOverflowPolicy when the consumer falls behind, and counting what was
+// dropped per device.
+//
+//   producer: publish(frame)           consumer: while (f = receive()) { ...; release(f); }
+//
+// Stats getters may be called from any thread.
+class FrameChannel {
+public:
+    struct DeviceStats {
+        uint64_t dropped = 0;   // Frames discarded or overwritten before the consumer saw them
+        uint32_t pending = 0;   // Frames currently waiting
+        uint32_t highWater = 0; // Most frames ever waiting at once
+    };
+
+    explicit FrameChannel(size_t capacity, FrameOverflowPolicy policy = FrameOverflowPolicy::DropNewest);
+
+    FrameChannel(const FrameChannel&) = delete;
+    FrameChannel& operator=(const FrameChannel&) = delete;
+
+    // Must be set before the producer thread starts.
+    void setOverflowPolicy(FrameOverflowPolicy policy) { policy_ = policy; }
+    FrameOverflowPolicy getOverflowPolicy() const { return policy_; }
+
+    // --- Producer (poll thread) ---
+
+    // Copies frame into a pooled frame and queues it. Returns false if this
+    // frame was dropped (DropNewest, or no frame could be freed).
+    bool publish(const FrameData& frame);
+
+    // --- Consumer (main loop) ---
+
+    // Next frame to process, or nullptr when nothing is waiting. The frame's
+    // deviceSlot is set. Hand it back with release() when done.
+    FrameData* receive();
+    void release(FrameData* frame) { pool_.release(frame); }
+
+    // --- Stats ---
+
+    size_t capacity() const { return pool_.capacity(); }
+    const DeviceSlotTable& deviceSlots() const { return deviceSlots_; }
+    DeviceStats getDeviceStats(size_t slot) const;
+    uint64_t getTotalDropped() const { return totalDropped_.load(std::memory_order_relaxed); }
+    uint32_t getHighWater() const { return highWater_.load(std::memory_order_relaxed); }
+    // Frames currently waiting for the consumer, all devices.
+    uint32_t getPending() const { return pending_.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(64) SlotCounters {
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint32_t> pending{0};
+        std::atomic<uint32_t> highWater{0};
+    };
+
+    void countQueued(uint8_t slot);
+    void updateHighWater(uint8_t slot);
+    void countTaken(uint8_t slot);
+    void countDropped(uint8_t slot);
+    FrameData* receiveCoalesced();
+
+    FrameOverflowPolicy policy_;
+    ObjectPool<FrameData> pool_;
+    DeviceSlotTable deviceSlots_; // Written by the producer
+
+    // CoalesceLatest: newest waiting frame per device slot. The producer swaps
+    // a new frame in; whatever comes back out was never seen by the consumer.
+    std::array<std::atomic<FrameData*>, MAX_TRACKED_DEVICES> mailboxes_{};
+    FrameData* spare_ = nullptr;  // Producer-owned frame evicted from a mailbox, reused next publish
+    size_t nextMailbox_ = 0;      // Consumer round-robin cursor
+
+    std::array<SlotCounters, MAX_TRACKED_DEVICES> counters_;
+    std::atomic<uint32_t> pending_{0};
+    std::atomic<uint32_t> highWater_{0};
+    std::atomic<uint64_t> totalDropped_{0};
+};
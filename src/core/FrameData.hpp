@@ -2,11 +2,27 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <cstddef>
 #include "HandData.hpp"
 
+// Capacity reserved for hands in every frame buffer, so filling one never reallocates.
+constexpr size_t MAX_HANDS_PER_FRAME = 4;
+// Upper bound on simultaneously tracked devices; sizes fixed per-device tables.
+constexpr size_t MAX_TRACKED_DEVICES = 16;
+// deviceSlot value for a frame whose device has no slot (see DeviceSlotTable).
+constexpr uint8_t INVALID_DEVICE_SLOT = 0xFF;
+
+// Bit i selects frame.hands[i], so a stage can pass on some of a frame's hands
+// without copying them. Hands past the 32nd are never selected.
+using HandMask = uint32_t;
+constexpr HandMask ALL_HANDS = ~HandMask(0);
+constexpr HandMask handBit(size_t index) { return index < 32 ? HandMask(1) << index : 0; }
+
 struct FrameData {
     std::string deviceId;
     uint64_t timestamp = 0;
     std::vector<HandData> hands;
+    uint8_t deviceSlot = INVALID_DEVICE_SLOT; // Stamped by FrameChannel on the way to the main loop
+    bool deviceLost = false; // Marker frame without hands: the device disconnected, reset its outputs
     // Add frameId or other metadata as needed
 };
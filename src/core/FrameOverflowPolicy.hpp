@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <algorithm>
+#include <cctype>
+
+// What the poll thread does when the main loop falls behind and the frame
+// channel has no free frame left. Set via "frame_queue_overflow_policy".
+enum class FrameOverflowPolicy {
+    DropNewest,     // Discard the incoming frame (original behaviour)
+    DropOldest,     // Overwrite the oldest frame still waiting in the queue
+    CoalesceLatest  // Keep only the newest waiting frame per device
+};
+
+inline const char* frameOverflowPolicyToString(FrameOverflowPolicy policy) {
+    switch (policy) {
+        case FrameOverflowPolicy::DropOldest:     return "drop_oldest";
+        case FrameOverflowPolicy::CoalesceLatest: return "coalesce";
+        default:                                  return "drop_newest";
+    }
+}
+
+inline FrameOverflowPolicy frameOverflowPolicyFromString(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    std::replace(value.begin(), value.end(), '-', '_');
+    if (value == "drop_oldest") return FrameOverflowPolicy::DropOldest;
+    if (value == "coalesce" || value == "coalesce_latest" || value == "latest") return FrameOverflowPolicy::CoalesceLatest;
+    return FrameOverflowPolicy::DropNewest;
+}
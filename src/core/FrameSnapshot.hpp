@@ -0,0 +1,46 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include "FrameData.hpp"
+
+// Fixed-layout, trivially copyable mirror of FrameData. Used where a frame has
+// to be copied with memcpy semantics (e.g. SeqLock cells) instead of through
+// std::string/std::vector members.
+
+constexpr size_t SNAPSHOT_ID_LENGTH = 32; // Including the terminating NUL
+
+struct FrameSnapshot {
+    char deviceId[SNAPSHOT_ID_LENGTH] = {};
+    uint64_t timestamp = 0;
+    uint32_t handCount = 0; // Hands beyond MAX_HANDS_PER_FRAME are dropped
+    std::array<HandData, MAX_HANDS_PER_FRAME> hands; // HandData has no heap members, so it is stored as is
+};
+
+// Copies a string into a fixed char buffer, truncating and always NUL-terminating.
+template<size_t N>
+inline void copyToFixed(char (&dest)[N], const std::string& src) {
+    const size_t len = src.size() < N - 1 ? src.size() : N - 1;
+    std::memcpy(dest, src.data(), len);
+    dest[len] = '\0';
+}
+
+inline void toSnapshot(const FrameData& frame, FrameSnapshot& out) {
+    copyToFixed(out.deviceId, frame.deviceId);
+    out.timestamp = frame.timestamp;
+    out.handCount = static_cast<uint32_t>(frame.hands.size() < MAX_HANDS_PER_FRAME ? frame.hands.size() : MAX_HANDS_PER_FRAME);
+    for (uint32_t i = 0; i < out.handCount; ++i) {
+        out.hands[i] = frame.hands[i];
+    }
+}
+
+// Reuses out's existing storage, so refreshing the same FrameData does not allocate.
+inline void fromSnapshot(const FrameSnapshot& snapshot, FrameData& out) {
+    out.deviceId.assign(snapshot.deviceId);
+    out.timestamp = snapshot.timestamp;
+    out.hands.resize(snapshot.handCount);
+    for (uint32_t i = 0; i < snapshot.handCount; ++i) {
+        out.hands[i] = snapshot.hands[i];
+    }
+}
@@ -0,0 +1,95 @@
+#include "GestureDetector.hpp"
+#include <algorithm>
+#include <cmath>
+
+const char* gestureEventAddress(GestureEvent event) {
+    switch (event) {
+        case GestureEvent::PinchStart: return "pinch/start";
+        case GestureEvent::PinchEnd:   return "pinch/end";
+        case GestureEvent::GrabStart:  return "grab/start";
+        case GestureEvent::GrabEnd:    return "grab/end";
+        case GestureEvent::SwipeLeft:  return "swipe/left";
+        case GestureEvent::SwipeRight: return "swipe/right";
+        case GestureEvent::SwipeUp:    return "swipe/up";
+        case GestureEvent::SwipeDown:  return "swipe/down";
+        case GestureEvent::Tap:        return "tap";
+        case GestureEvent::HandEnter:  return "enter";
+        case GestureEvent::HandExit:   return "exit";
+        default:                       return "change";
+    }
+}
+
+GestureEvents GestureDetector::update(const HandData& hand, uint64_t timestampUs, const GestureConfig& config) {
+    GestureEvents events = 0;
+
+    // Pinch and grab: on above the on threshold, off below the off threshold
+    if (!pinching_ && hand.pinchStrength >= config.pinchOn) {
+        pinching_ = true;
+        events |= gestureEventBit(GestureEvent::PinchStart);
+    } else if (pinching_ && hand.pinchStrength < config.pinchOff) {
+        pinching_ = false;
+        events |= gestureEventBit(GestureEvent::PinchEnd);
+    }
+    if (!grabbing_ && hand.grabStrength >= config.grabOn) {
+        grabbing_ = true;
+        events |= gestureEventBit(GestureEvent::GrabStart);
+    } else if (grabbing_ && hand.grabStrength < config.grabOff) {
+        grabbing_ = false;
+        events |= gestureEventBit(GestureEvent::GrabEnd);
+    }
+
+    // A frame that is not newer than the newest sample restarts the window
+    if (count_ > 0 && timestampUs <= sample(0).timestampUs) count_ = 0;
+    head_ = (head_ + 1) % WINDOW;
+    Sample& newest = samples_[head_];
+    newest.palm = hand.palm.position;
+    newest.tipY = hand.fingers[1].bones[3].nextJoint.y;
+    newest.tipValid = hand.fingers[1].isValid() && hand.fingers[1].bones[3].isValid();
+    newest.timestampUs = timestampUs;
+    if (count_ < WINDOW) ++count_;
+    if (count_ < 2) return events;
+
+    // Swipe: palm velocity over the window, fired once per stroke along its dominant axis
+    const Sample& oldest = sample(count_ - 1);
+    const float windowDt = static_cast<float>(timestampUs - oldest.timestampUs) * 1e-6f;
+    const float vx = (newest.palm.x - oldest.palm.x) / windowDt;
+    const float vy = (newest.palm.y - oldest.palm.y) / windowDt;
+    const float speed = (std::max)(std::fabs(vx), std::fabs(vy));
+    if (!swiping_ && count_ == WINDOW && speed >= config.swipeSpeed) {
+        swiping_ = true;
+        if (std::fabs(vx) >= std::fabs(vy)) {
+            events |= gestureEventBit(vx < 0 ? GestureEvent::SwipeLeft : GestureEvent::SwipeRight);
+        } else {
+            events |= gestureEventBit(vy < 0 ? GestureEvent::SwipeDown : GestureEvent::SwipeUp);
+        }
+    } else if (swiping_ && speed < config.swipeSpeed * 0.5f) {
+        swiping_ = false;
+    }
+
+    // Tap: a short, fast down-stroke of the index fingertip while the palm holds still
+    const size_t tapBack = (count_ < TAP_FRAMES ? count_ : TAP_FRAMES) - 1;
+    const Sample& tapFrom = sample(tapBack);
+    if (!newest.tipValid || !tapFrom.tipValid) {
+        tapDown_ = false;
+        return events;
+    }
+    const float tipVy = (newest.tipY - tapFrom.tipY) / (static_cast<float>(timestampUs - tapFrom.timestampUs) * 1e-6f);
+    if (!tapDown_) {
+        if (tipVy <= -config.tapSpeed && speed < config.tapSpeed * 0.5f) {
+            tapDown_ = true;
+            tapStartUs_ = timestampUs;
+        }
+    } else if (tipVy > -config.tapSpeed * 0.25f) {
+        tapDown_ = false;
+        if (timestampUs - tapStartUs_ <= uint64_t(config.tapMaxMs) * 1000) events |= gestureEventBit(GestureEvent::Tap);
+    }
+    return events;
+}
+
+GestureEvents GestureDetector::release() {
+    GestureEvents events = 0;
+    if (pinching_) events |= gestureEventBit(GestureEvent::PinchEnd);
+    if (grabbing_) events |= gestureEventBit(GestureEvent::GrabEnd);
+    *this = GestureDetector();
+    return events;
+}
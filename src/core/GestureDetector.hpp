@@ -0,0 +1,72 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "HandData.hpp"
+
+// Discrete hand events, so OSC clients get triggers instead of each one
+// thresholding pinchStrength/grabStrength and velocities itself.
+//
+// One GestureDetector per hand, updated once per frame in constant time:
+// pinch and grab use on/off thresholds (hysteresis), swipe and tap read
+// velocities over the last few frames, kept in a small ring of samples.
+// Hand enter/exit/change come from DataProcessor's presence tracking.
+
+enum class GestureEvent : uint8_t {
+    PinchStart, PinchEnd, GrabStart, GrabEnd,
+    SwipeLeft, SwipeRight, SwipeUp, SwipeDown,
+    Tap, HandEnter, HandExit,
+    HandChange, // Another hand (a new tracker id) took over the hand type's outputs
+    Count
+};
+constexpr size_t GESTURE_EVENT_COUNT = static_cast<size_t>(GestureEvent::Count);
+
+// Bit per GestureEvent; what one update() fired.
+using GestureEvents = uint16_t;
+constexpr GestureEvents gestureEventBit(GestureEvent event) { return GestureEvents(1) << static_cast<unsigned>(event); }
+
+const char* gestureEventAddress(GestureEvent event); // "pinch/start", ..., "tap", "enter", "exit", "change"
+
+struct GestureConfig {
+    float pinchOn = 0.8f;     // pinchStrength that starts a pinch
+    float pinchOff = 0.6f;    // ... and that ends it
+    float grabOn = 0.8f;
+    float grabOff = 0.6f;
+    float swipeSpeed = 800.0f; // mm/s of palm speed along one axis; re-arms below half
+    float tapSpeed = 250.0f;   // mm/s of downward index fingertip speed
+    uint32_t tapMaxMs = 200;   // Longest down-stroke that still counts as a tap
+};
+
+class GestureDetector {
+public:
+    // Frames the swipe velocity is measured over; taps use the last TAP_FRAMES.
+    static constexpr size_t WINDOW = 8;
+    static constexpr size_t TAP_FRAMES = 3;
+
+    // Feeds one frame of the hand; returns the events it fired.
+    GestureEvents update(const HandData& hand, uint64_t timestampUs, const GestureConfig& config);
+
+    // Forgets the hand. Returns PinchEnd/GrabEnd for gestures still held, so a
+    // client never sees a start without an end.
+    GestureEvents release();
+
+private:
+    struct Sample {
+        Vector3 palm;
+        float tipY = 0;
+        bool tipValid = false;
+        uint64_t timestampUs = 0;
+    };
+    // Sample `back` frames before the newest (0 = newest); back < count_
+    const Sample& sample(size_t back) const { return samples_[(head_ + WINDOW - back) % WINDOW]; }
+
+    std::array<Sample, WINDOW> samples_{};
+    size_t head_ = 0;  // Newest sample
+    size_t count_ = 0; // Samples held, up to WINDOW
+
+    bool pinching_ = false;
+    bool grabbing_ = false;
+    bool swiping_ = false;     // A swipe fired and the palm hasn't slowed down yet
+    bool tapDown_ = false;     // Fingertip is in a fast down-stroke
+    uint64_t tapStartUs_ = 0;
+};
@@ -1,6 +1,5 @@
 #pragma once
-#include <string>
-#include <vector>
+#include <array>
 #include <cstdint>
 
 struct Vector3 {
@@ -44,17 +43,33 @@ struct FingerData {
     int fingerId = 0;
     bool isExtended = false;
     float extendedConfidence = 0;
-    std::vector<BoneData> bones;
+    // Metacarpal, proximal, intermediate, distal. Fixed size so frames can be
+    // copied and recycled without touching the heap.
+    std::array<BoneData, 4> bones;
     bool valid = true; // NEW: default valid
     bool isValid() const { return valid; }
     void setValid(bool v) { valid = v; }
 };
 
+// Values double as indices into per-hand tables (left = 0, right = 1).
+enum class HandType : uint8_t { Left, Right };
+
+inline const char* handTypeName(HandType type) {
+    return type == HandType::Left ? "left" : "right";
+}
+
+// Bit per HandType for per-device presence masks (bit 0 = left, bit 1 = right).
+using HandPresence = uint8_t;
+constexpr HandPresence handPresenceBit(HandType type) {
+    return static_cast<HandPresence>(1u << static_cast<unsigned>(type));
+}
+
 struct HandData {
-    std::string handType; // "left" or "right"
+    HandType handType = HandType::Left;
+    uint32_t id = 0; // LEAP_HAND::id: kept while the hand stays tracked, never reused; 0 if unknown
     PalmData palm;
     ArmData arm;
-    std::vector<FingerData> fingers;
+    std::array<FingerData, 5> fingers; // thumb, index, middle, ring, pinky
     float pinchStrength = 0;
     float grabStrength = 0;
     float confidence = 0;
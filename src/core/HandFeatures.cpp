@@ -0,0 +1,116 @@
+#include "HandFeatures.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace {
+constexpr size_t FINGERS = 5;
+constexpr size_t LANES = 8; // Fingers padded to a whole vector
+constexpr float RAD_TO_DEG = 57.2957795f;
+using Lanes = std::array<float, LANES>;
+
+struct Directions {
+    Lanes x{}, y{}, z{};
+    Lanes valid{}; // 1 where the direction has a length, 0 for zero-length bones and padding
+};
+
+// Scales each lane to unit length, marking zero-length lanes invalid.
+void normalize(Directions& d) {
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        const float length = std::sqrt(d.x[lane] * d.x[lane] + d.y[lane] * d.y[lane] + d.z[lane] * d.z[lane]);
+        const bool valid = length > 1e-6f;
+        const float inverse = valid ? 1.0f / length : 0.0f;
+        d.x[lane] *= inverse;
+        d.y[lane] *= inverse;
+        d.z[lane] *= inverse;
+        d.valid[lane] = valid ? 1.0f : 0.0f;
+    }
+}
+
+// Unit direction of bone b of every finger. LeapC reports the thumb's
+// metacarpal with zero length, so that lane comes out invalid.
+Directions boneDirections(const HandData& hand, size_t b) {
+    Directions d;
+    for (size_t f = 0; f < FINGERS; ++f) {
+        const BoneData& bone = hand.fingers[f].bones[b];
+        d.x[f] = bone.nextJoint.x - bone.prevJoint.x;
+        d.y[f] = bone.nextJoint.y - bone.prevJoint.y;
+        d.z[f] = bone.nextJoint.z - bone.prevJoint.z;
+    }
+    normalize(d);
+    return d;
+}
+
+// Degrees between a and b, lane by lane; 0 where either is zero length.
+Lanes angleBetween(const Directions& a, const Directions& b) {
+    Lanes angle;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        const float dot = a.x[lane] * b.x[lane] + a.y[lane] * b.y[lane] + a.z[lane] * b.z[lane];
+        angle[lane] = std::acos((std::max)(-1.0f, (std::min)(1.0f, dot))) * RAD_TO_DEG * a.valid[lane] * b.valid[lane];
+    }
+    return angle;
+}
+
+Vector3 rotate(const Quaternion& q, const Vector3& v) {
+    // v + 2w(u x v) + 2u x (u x v), u = (q.x, q.y, q.z)
+    const Vector3 u = { q.x, q.y, q.z };
+    const Vector3 t = { 2.0f * (u.y * v.z - u.z * v.y), 2.0f * (u.z * v.x - u.x * v.z), 2.0f * (u.x * v.y - u.y * v.x) };
+    return { v.x + q.w * t.x + (u.y * t.z - u.z * t.y),
+             v.y + q.w * t.y + (u.z * t.x - u.x * t.z),
+             v.z + q.w * t.z + (u.x * t.y - u.y * t.x) };
+}
+}
+
+void computeHandFeatures(const HandData& hand, DerivedHandData& out) {
+    // Flexion and curl, all fingers at once
+    std::array<Directions, 4> bones;
+    for (size_t b = 0; b < 4; ++b) bones[b] = boneDirections(hand, b);
+    std::array<Lanes, 3> flexion;
+    for (size_t j = 0; j < 3; ++j) flexion[j] = angleBetween(bones[j], bones[j + 1]);
+    Lanes curl;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        curl[lane] = (std::min)(1.0f, (flexion[0][lane] + flexion[1][lane] + flexion[2][lane]) / FULL_CURL_DEGREES);
+    }
+
+    // Spread: proximal bones with their component along the palm normal removed
+    const Vector3& n = hand.palm.normal;
+    Directions proximal = bones[1];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        const float along = proximal.x[lane] * n.x + proximal.y[lane] * n.y + proximal.z[lane] * n.z;
+        proximal.x[lane] -= along * n.x;
+        proximal.y[lane] -= along * n.y;
+        proximal.z[lane] -= along * n.z;
+    }
+    normalize(proximal);
+    Directions next; // Lane f holds finger f + 1
+    for (size_t f = 0; f + 1 < FINGERS; ++f) {
+        next.x[f] = proximal.x[f + 1];
+        next.y[f] = proximal.y[f + 1];
+        next.z[f] = proximal.z[f + 1];
+        next.valid[f] = proximal.valid[f + 1];
+    }
+    const Lanes spread = angleBetween(proximal, next);
+
+    float openness = 0.0f;
+    size_t validFingers = 0;
+    for (size_t f = 0; f < FINGERS; ++f) {
+        const bool valid = hand.fingers[f].isValid();
+        for (size_t j = 0; j < 3; ++j) out.flexion[f][j] = flexion[j][f];
+        out.curl[f] = curl[f];
+        if (valid) {
+            openness += 1.0f - curl[f];
+            ++validFingers;
+        }
+        if (f + 1 < FINGERS) {
+            out.spread[f] = valid && hand.fingers[f + 1].isValid() ? spread[f] : 0.0f;
+        }
+    }
+    out.openness = validFingers ? openness / static_cast<float>(validFingers) : 0.0f;
+
+    // Palm angles from the rest-pose direction (-z) and normal (-y)
+    const Vector3 direction = rotate(hand.palm.orientation, { 0.0f, 0.0f, -1.0f });
+    const Vector3 normal = rotate(hand.palm.orientation, { 0.0f, -1.0f, 0.0f });
+    out.palmPitch = std::atan2(direction.y, -direction.z) * RAD_TO_DEG;
+    out.palmYaw = std::atan2(direction.x, -direction.z) * RAD_TO_DEG;
+    out.palmRoll = std::atan2(normal.x, -normal.y) * RAD_TO_DEG;
+}
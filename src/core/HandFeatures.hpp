@@ -0,0 +1,22 @@
+#pragma once
+#include "HandData.hpp"
+#include "DerivedHandData.hpp"
+
+// Biomechanics features computed once per hand, so receivers don't each
+// derive them from raw joints:
+//
+//  - flexion: bend at each finger's MCP, PIP and DIP joint, in degrees, as the
+//    angle between the directions (prevJoint -> nextJoint) of adjacent bones;
+//    0 where either bone has zero length (LeapC's thumb metacarpal)
+//  - curl: sum of a finger's three flexion angles over FULL_CURL_DEGREES, 0-1
+//  - spread: angle between adjacent fingers' proximal bones in the palm plane,
+//    in degrees; 0 where either finger is invalid
+//  - palm roll/pitch/yaw in degrees from PalmData::orientation, using the
+//    tracker axes (x right, y up, z toward the user) and the palm's rest pose
+//    (facing down, fingers along -z)
+//  - openness: 1 - mean curl of the valid fingers, 0 = fist, 1 = flat hand
+//
+// The per-finger work runs over fingers as struct-of-arrays lanes.
+constexpr float FULL_CURL_DEGREES = 270.0f;
+
+void computeHandFeatures(const HandData& hand, DerivedHandData& out);
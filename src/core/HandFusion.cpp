@@ -0,0 +1,285 @@
+#include "HandFusion.hpp"
+#include "DeviceAliasManager.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr float MIN_WEIGHT = 0.01f; // Hands reporting zero confidence still count a little
+
+Quaternion multiply(const Quaternion& a, const Quaternion& b) {
+    return { a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+             a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+             a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+             a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w };
+}
+
+Quaternion rotationToQuaternion(const std::array<float, 9>& r) {
+    // Shepperd's method: divide by the largest of the four candidates
+    Quaternion q;
+    const float trace = r[0] + r[4] + r[8];
+    if (trace > 0.0f) {
+        const float s = std::sqrt(trace + 1.0f) * 2.0f;
+        q = { 0.25f * s, (r[7] - r[5]) / s, (r[2] - r[6]) / s, (r[3] - r[1]) / s };
+    } else if (r[0] > r[4] && r[0] > r[8]) {
+        const float s = std::sqrt(1.0f + r[0] - r[4] - r[8]) * 2.0f;
+        q = { (r[7] - r[5]) / s, 0.25f * s, (r[1] + r[3]) / s, (r[2] + r[6]) / s };
+    } else if (r[4] > r[8]) {
+        const float s = std::sqrt(1.0f + r[4] - r[0] - r[8]) * 2.0f;
+        q = { (r[2] - r[6]) / s, (r[1] + r[3]) / s, 0.25f * s, (r[5] + r[7]) / s };
+    } else {
+        const float s = std::sqrt(1.0f + r[8] - r[0] - r[4]) * 2.0f;
+        q = { (r[3] - r[1]) / s, (r[2] + r[6]) / s, (r[5] + r[7]) / s, 0.25f * s };
+    }
+    return q;
+}
+
+void accumulate(Vector3& sum, const Vector3& v, float w) {
+    sum.x += v.x * w;
+    sum.y += v.y * w;
+    sum.z += v.z * w;
+}
+
+void scale(Vector3& v, float s) {
+    v.x *= s;
+    v.y *= s;
+    v.z *= s;
+}
+
+// Adds q on the anchor's side of the double cover, so opposite signs don't cancel
+void accumulate(Quaternion& sum, const Quaternion& q, const Quaternion& anchor, float w) {
+    const float sign = anchor.w * q.w + anchor.x * q.x + anchor.y * q.y + anchor.z * q.z < 0.0f ? -w : w;
+    sum.w += q.w * sign;
+    sum.x += q.x * sign;
+    sum.y += q.y * sign;
+    sum.z += q.z * sign;
+}
+
+void normalize(Quaternion& q) {
+    const float length = std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+    if (length < 1e-6f) {
+        q = Quaternion();
+        return;
+    }
+    q.w /= length;
+    q.x /= length;
+    q.y /= length;
+    q.z /= length;
+}
+
+void normalize(Vector3& v) {
+    const float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+    if (length > 1e-6f) scale(v, 1.0f / length);
+}
+
+float distance(const Vector3& a, const Vector3& b) {
+    const float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// Every position of a hand, for shifting and averaging them alike
+template<typename Fn>
+void forEachPosition(HandData& hand, Fn&& fn) {
+    fn(hand.palm.position);
+    fn(hand.arm.wristPosition);
+    fn(hand.arm.elbowPosition);
+    for (FingerData& finger : hand.fingers) {
+        for (BoneData& bone : finger.bones) {
+            fn(bone.prevJoint);
+            fn(bone.nextJoint);
+        }
+    }
+}
+
+template<typename Fn>
+void forEachPositionPair(HandData& out, const HandData& in, Fn&& fn) {
+    fn(out.palm.position, in.palm.position);
+    fn(out.arm.wristPosition, in.arm.wristPosition);
+    fn(out.arm.elbowPosition, in.arm.elbowPosition);
+    for (size_t f = 0; f < out.fingers.size(); ++f) {
+        for (size_t b = 0; b < out.fingers[f].bones.size(); ++b) {
+            fn(out.fingers[f].bones[b].prevJoint, in.fingers[f].bones[b].prevJoint);
+            fn(out.fingers[f].bones[b].nextJoint, in.fingers[f].bones[b].nextJoint);
+        }
+    }
+}
+}
+
+Vector3 RigidTransform::applyToPoint(const Vector3& p) const {
+    Vector3 out = applyToDirection(p);
+    out.x += translation.x;
+    out.y += translation.y;
+    out.z += translation.z;
+    return out;
+}
+
+Vector3 RigidTransform::applyToDirection(const Vector3& v) const {
+    const auto& r = rotation;
+    return { r[0] * v.x + r[1] * v.y + r[2] * v.z,
+             r[3] * v.x + r[4] * v.y + r[5] * v.z,
+             r[6] * v.x + r[7] * v.y + r[8] * v.z };
+}
+
+Quaternion RigidTransform::applyToRotation(const Quaternion& q) const {
+    return multiply(rotationToQuaternion(rotation), q);
+}
+
+RigidTransform RigidTransform::fromMatrix(const std::array<float, 16>& m) {
+    RigidTransform transform;
+    transform.rotation = { m[0], m[1], m[2], m[4], m[5], m[6], m[8], m[9], m[10] };
+    transform.translation = { m[3], m[7], m[11] };
+    return transform;
+}
+
+std::array<float, 16> RigidTransform::toMatrix() const {
+    const auto& r = rotation;
+    return { r[0], r[1], r[2], translation.x,
+             r[3], r[4], r[5], translation.y,
+             r[6], r[7], r[8], translation.z,
+             0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+RigidTransform compose(const RigidTransform& outer, const RigidTransform& inner) {
+    RigidTransform result;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            float sum = 0.0f;
+            for (size_t k = 0; k < 3; ++k) sum += outer.rotation[i * 3 + k] * inner.rotation[k * 3 + j];
+            result.rotation[i * 3 + j] = sum;
+        }
+    }
+    result.translation = outer.applyToPoint(inner.translation);
+    return result;
+}
+
+void transformHand(const RigidTransform& transform, HandData& hand) {
+    forEachPosition(hand, [&](Vector3& p) { p = transform.applyToPoint(p); });
+    hand.palm.velocity = transform.applyToDirection(hand.palm.velocity);
+    hand.palm.normal = transform.applyToDirection(hand.palm.normal);
+    hand.palm.direction = transform.applyToDirection(hand.palm.direction);
+    const Quaternion rotation = rotationToQuaternion(transform.rotation);
+    hand.palm.orientation = multiply(rotation, hand.palm.orientation);
+    hand.arm.rotation = multiply(rotation, hand.arm.rotation);
+    for (FingerData& finger : hand.fingers) {
+        for (BoneData& bone : finger.bones) bone.rotation = multiply(rotation, bone.rotation);
+    }
+}
+
+void HandFusion::setConfig(const FusionConfig& config) {
+    config_.update([&](Versioned& next) {
+        ++next.version;
+        next.config = config;
+    });
+}
+
+void HandFusion::update(const FrameData& frame) {
+    if (frame.deviceSlot >= MAX_TRACKED_DEVICES) return;
+    DeviceHands& device = devices_[frame.deviceSlot];
+    if (frame.deviceLost) {
+        device.present = 0;
+        return;
+    }
+    const std::shared_ptr<const Versioned> snapshot = config_.load();
+    const Versioned& config = *snapshot;
+    if (device.transformVersion != config.version) {
+        const auto extrinsic = config.config.extrinsics.find(frame.deviceId);
+        device.transform = extrinsic != config.config.extrinsics.end() ? extrinsic->second : RigidTransform();
+        device.transformVersion = config.version;
+    }
+    device.present = 0;
+    device.timestampUs = frame.timestamp;
+    newestUs_ = (std::max)(newestUs_, frame.timestamp);
+    for (const HandData& hand : frame.hands) {
+        const size_t h = static_cast<size_t>(hand.handType);
+        device.hands[h] = hand; // Fixed-size copy
+        transformHand(device.transform, device.hands[h]);
+        device.present |= handPresenceBit(hand.handType);
+    }
+}
+
+void HandFusion::fuse(FrameData& out) const {
+    const std::shared_ptr<const Versioned> snapshot = config_.load();
+    const FusionConfig& config = snapshot->config;
+    out.deviceId = FUSED_DEVICE_ID;
+    out.deviceSlot = INVALID_DEVICE_SLOT;
+    out.deviceLost = false;
+    out.timestamp = newestUs_;
+    out.hands.clear();
+    const uint64_t maxAgeUs = uint64_t(config.maxAgeMs) * 1000;
+
+    for (size_t h = 0; h < 2; ++h) {
+        const HandPresence bit = handPresenceBit(static_cast<HandType>(h));
+        auto fresh = [&](const DeviceHands& device) {
+            return (device.present & bit) && newestUs_ - device.timestampUs <= maxAgeUs;
+        };
+        // How far the device's hand moves up to the fused timestamp at its palm velocity
+        auto shiftOf = [&](const DeviceHands& device) {
+            Vector3 shift = device.hands[h].palm.velocity;
+            scale(shift, static_cast<float>(newestUs_ - device.timestampUs) * 1e-6f);
+            return shift;
+        };
+
+        // Anchor: the most confident fresh hand of this type
+        const DeviceHands* anchor = nullptr;
+        for (const DeviceHands& device : devices_) {
+            if (fresh(device) && (!anchor || device.hands[h].confidence > anchor->hands[h].confidence)) anchor = &device;
+        }
+        if (!anchor) continue;
+
+        out.hands.emplace_back(); // Within the reserved capacity after the first frames
+        HandData& fused = out.hands.back();
+        fused = anchor->hands[h];
+        // Moved forward too: the anchor's frame may be the stale one
+        Vector3 anchorPalm = anchor->hands[h].palm.position;
+        accumulate(anchorPalm, shiftOf(*anchor), 1.0f);
+        const Quaternion anchorPalmRotation = anchor->hands[h].palm.orientation;
+        const Quaternion anchorArmRotation = anchor->hands[h].arm.rotation;
+
+        // Ids are per device and the anchor may change device; the fused hand is one per type
+        fused.id = 0;
+        // Weighted sums; fused still holds the anchor's flags and visible time
+        forEachPosition(fused, [](Vector3& p) { p = Vector3(); });
+        fused.palm.velocity = fused.palm.normal = fused.palm.direction = Vector3();
+        fused.palm.orientation = fused.arm.rotation = Quaternion{ 0, 0, 0, 0 };
+        fused.palm.width = fused.arm.width = 0.0f;
+        fused.pinchStrength = fused.grabStrength = 0.0f;
+        float totalWeight = 0.0f;
+        for (const DeviceHands& device : devices_) {
+            if (!fresh(device)) continue;
+            const HandData& hand = device.hands[h];
+            // Moved forward to the fused timestamp at the palm's velocity
+            const Vector3 shift = shiftOf(device);
+            Vector3 palm = hand.palm.position;
+            accumulate(palm, shift, 1.0f);
+            if (&device != anchor && distance(palm, anchorPalm) > config.associationRadiusMm) continue;
+
+            const float w = (std::max)(hand.confidence, MIN_WEIGHT);
+            totalWeight += w;
+            forEachPositionPair(fused, hand, [&](Vector3& sum, const Vector3& p) {
+                accumulate(sum, p, w);
+                accumulate(sum, shift, w);
+            });
+            accumulate(fused.palm.velocity, hand.palm.velocity, w);
+            accumulate(fused.palm.normal, hand.palm.normal, w);
+            accumulate(fused.palm.direction, hand.palm.direction, w);
+            accumulate(fused.palm.orientation, hand.palm.orientation, anchorPalmRotation, w);
+            accumulate(fused.arm.rotation, hand.arm.rotation, anchorArmRotation, w);
+            fused.palm.width += hand.palm.width * w;
+            fused.arm.width += hand.arm.width * w;
+            fused.pinchStrength += hand.pinchStrength * w;
+            fused.grabStrength += hand.grabStrength * w;
+            fused.visibleTime = (std::max)(fused.visibleTime, hand.visibleTime);
+        }
+
+        const float inverse = 1.0f / totalWeight;
+        forEachPosition(fused, [&](Vector3& p) { scale(p, inverse); });
+        scale(fused.palm.velocity, inverse);
+        normalize(fused.palm.normal);
+        normalize(fused.palm.direction);
+        normalize(fused.palm.orientation);
+        normalize(fused.arm.rotation);
+        fused.palm.width *= inverse;
+        fused.arm.width *= inverse;
+        fused.pinchStrength *= inverse;
+        fused.grabStrength *= inverse;
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include "FrameData.hpp"
+#include "HandData.hpp"
+#include "../utils/AtomicSnapshot.h"
+
+// Rigid transform from a device's coordinates (millimetres) into the shared
+// room space: p' = rotation * p + translation.
+struct RigidTransform {
+    std::array<float, 9> rotation = { 1, 0, 0, 0, 1, 0, 0, 0, 1 }; // Row-major
+    Vector3 translation;
+
+    Vector3 applyToPoint(const Vector3& p) const;
+    Vector3 applyToDirection(const Vector3& v) const;
+    Quaternion applyToRotation(const Quaternion& q) const;
+
+    // 4x4 row-major matrix, as saved in config.json; the last row is ignored
+    static RigidTransform fromMatrix(const std::array<float, 16>& m);
+    std::array<float, 16> toMatrix() const;
+};
+
+// outer after inner: p -> outer.applyToPoint(inner.applyToPoint(p))
+RigidTransform compose(const RigidTransform& outer, const RigidTransform& inner);
+
+// Moves every position, direction and rotation of hand into the transform's space.
+void transformHand(const RigidTransform& transform, HandData& hand);
+
+struct FusionConfig {
+    bool enabled = false;
+    float associationRadiusMm = 80.0f; // Hands of the same type with palms this close are one hand
+    uint32_t maxAgeMs = 50;            // Devices whose last frame is older than this are left out
+    // By device serial; devices without one are taken to be at the room origin
+    std::map<std::string, RigidTransform> extrinsics;
+};
+
+// Multi-device fusion: the latest hands of every device, moved into room
+// space, merged into at most one left and one right hand.
+//
+// update() takes each device frame as it arrives; fuse() then builds the fused
+// frame at the newest timestamp seen. Per hand type, the most confident hand
+// is the anchor, and every other hand of that type whose palm lies within
+// associationRadiusMm of it is averaged in, weighted by confidence. Hands from
+// older frames are first moved forward by their palm velocity, so devices
+// running out of phase line up in time.
+//
+// update() and fuse() are for one thread (the main loop); setConfig() is for
+// any thread. Frames without a device slot are ignored.
+class HandFusion {
+public:
+    void setConfig(const FusionConfig& config);
+    FusionConfig getConfig() const { return config_.load()->config; }
+
+    // Stores the frame's hands in room space; a deviceLost frame forgets the device.
+    void update(const FrameData& frame);
+    // Fills out with the fused hands (deviceId FUSED_DEVICE_ID). Reuses out's storage.
+    void fuse(FrameData& out) const;
+
+private:
+    struct DeviceHands {
+        std::array<HandData, 2> hands; // By HandType
+        HandPresence present = 0;
+        uint64_t timestampUs = 0;
+        RigidTransform transform;      // For config version transformVersion
+        uint64_t transformVersion = UINT64_MAX;
+    };
+    struct Versioned {
+        uint64_t version = 0;
+        FusionConfig config;
+    };
+
+    AtomicSnapshot<Versioned> config_;
+    std::array<DeviceHands, MAX_TRACKED_DEVICES> devices_{};
+    uint64_t newestUs_ = 0;
+};
@@ -0,0 +1,39 @@
+#include "HandPoints.hpp"
+#include "OscFieldRegistry.hpp"
+
+void gatherHandPoints(const HandData& hand, HandPointPositions& out) {
+    const uint32_t validity = handValidity(hand);
+    for (size_t a = 0; a < 3; ++a) {
+        out.position[a][0] = *vectorAxis(hand.palm.position, a);
+        out.position[a][1] = *vectorAxis(hand.arm.wristPosition, a);
+        for (size_t f = 0; f < 5; ++f) out.position[a][2 + f] = *vectorAxis(hand.fingers[f].bones[3].nextJoint, a);
+    }
+    out.valid[0] = 1.0f;
+    out.valid[1] = (validity & (1u << OSC_GUARD_ARM)) ? 1.0f : 0.0f;
+    for (size_t f = 0; f < 5; ++f) out.valid[2 + f] = (validity & (1u << (OSC_GUARD_FINGER + f))) ? 1.0f : 0.0f;
+}
+
+void gatherHandJoints(const HandData& hand, HandJointLanes& out) {
+    for (size_t a = 0; a < 3; ++a) {
+        out[a][0] = *vectorAxis(hand.palm.position, a);
+        out[a][1] = *vectorAxis(hand.arm.wristPosition, a);
+        size_t lane = 2;
+        for (const FingerData& finger : hand.fingers) {
+            for (const BoneData& bone : finger.bones) out[a][lane++] = *vectorAxis(bone.nextJoint, a);
+        }
+    }
+}
+
+void scatterHandJoints(const HandJointLanes& lanes, HandData& hand) {
+    for (size_t a = 0; a < 3; ++a) {
+        *vectorAxis(hand.palm.position, a) = lanes[a][0];
+        *vectorAxis(hand.arm.wristPosition, a) = lanes[a][1];
+        size_t lane = 2;
+        for (FingerData& finger : hand.fingers) {
+            for (size_t b = 0; b < finger.bones.size(); ++b, ++lane) {
+                *vectorAxis(finger.bones[b].nextJoint, a) = lanes[a][lane];
+                if (b + 1 < finger.bones.size()) *vectorAxis(finger.bones[b + 1].prevJoint, a) = lanes[a][lane];
+            }
+        }
+    }
+}
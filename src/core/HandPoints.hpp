@@ -0,0 +1,37 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "HandData.hpp"
+
+// The points per-point stages work on: palm, wrist and the five fingertips.
+enum class HandPoint : uint8_t { Palm, Wrist, Thumb, Index, Middle, Ring, Pinky, Count };
+constexpr size_t HAND_POINT_COUNT = static_cast<size_t>(HandPoint::Count);
+
+// One lane per HandPoint, padded so a pass over all lanes has a fixed length
+// the compiler can vectorize.
+constexpr size_t HAND_POINT_LANES = 8;
+using HandPointLanes = std::array<float, HAND_POINT_LANES>;
+
+// A hand's points as struct-of-arrays, gathered once per frame and shared by
+// the stages that use them.
+struct HandPointPositions {
+    std::array<HandPointLanes, 3> position{}; // [axis][lane], millimetres
+    HandPointLanes valid{};                   // 1 where the point's arm or finger is valid
+};
+
+void gatherHandPoints(const HandData& hand, HandPointPositions& out);
+
+// Every joint a hand's positions are made of, for the stages that move them
+// all: palm, wrist, then the next joint of each finger's four bones (a bone's
+// previous joint is the next joint of the bone before it).
+constexpr size_t HAND_JOINT_POINTS = 2 + 5 * 4;
+constexpr size_t HAND_JOINT_LANES = 24; // HAND_JOINT_POINTS padded to a multiple of 8
+using HandJointLanes = std::array<std::array<float, HAND_JOINT_LANES>, 3>; // [axis][lane]
+
+void gatherHandJoints(const HandData& hand, HandJointLanes& out);
+// Writes the lanes back, joining each finger's bone chain
+void scatterHandJoints(const HandJointLanes& lanes, HandData& hand);
+
+inline const float* vectorAxis(const Vector3& v, size_t a) { return a == 0 ? &v.x : a == 1 ? &v.y : &v.z; }
+inline float* vectorAxis(Vector3& v, size_t a) { return a == 0 ? &v.x : a == 1 ? &v.y : &v.z; }
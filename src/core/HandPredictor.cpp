@@ -0,0 +1,64 @@
+#include "HandPredictor.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+struct Gains {
+    float alpha; // Share of the position residual taken
+    float beta;  // Share of the residual, per frame interval, taken into the velocity
+};
+
+// Steady-state gains of the constant-velocity Kalman filter (Kalata's
+// tracking index): lambda = accelerationNoise * dt^2 / measurementNoise.
+Gains kalmanGains(const PredictionConfig& config, float dt) {
+    const float lambda = config.accelerationNoise * dt * dt / (std::max)(config.measurementNoise, 1e-3f);
+    const float r = (4.0f + lambda - std::sqrt(8.0f * lambda + lambda * lambda)) / 4.0f;
+    const float alpha = 1.0f - r * r;
+    const float beta = 2.0f * (2.0f - alpha) - 4.0f * std::sqrt(1.0f - alpha);
+    return { alpha, beta };
+}
+}
+
+const char* predictionModeToString(PredictionMode mode) {
+    switch (mode) {
+        case PredictionMode::ConstantVelocity: return "constant_velocity";
+        case PredictionMode::Kalman:           return "kalman";
+        default:                               return "off";
+    }
+}
+
+PredictionMode predictionModeFromString(const std::string& text) {
+    if (text == "constant_velocity") return PredictionMode::ConstantVelocity;
+    if (text == "kalman") return PredictionMode::Kalman;
+    return PredictionMode::Off;
+}
+
+void HandPredictor::apply(HandData& hand, uint64_t timestampUs, uint64_t lookaheadUs, const PredictionConfig& config) {
+    gatherHandJoints(hand, raw_);
+    if (!initialized_ || timestampUs <= lastTimestampUs_) {
+        position_ = raw_;
+        for (auto& axis : velocity_) axis.fill(0.0f);
+        initialized_ = true;
+        lastTimestampUs_ = timestampUs;
+        return;
+    }
+    const float dt = static_cast<float>(timestampUs - lastTimestampUs_) * 1e-6f;
+    lastTimestampUs_ = timestampUs;
+
+    const Gains gains = config.mode == PredictionMode::Kalman ? kalmanGains(config, dt) : Gains{ 1.0f, 1.0f };
+    const float betaRate = gains.beta / dt;
+    const float lookahead = static_cast<float>(lookaheadUs) * 1e-6f;
+    for (size_t a = 0; a < 3; ++a) {
+        auto& position = position_[a];
+        auto& velocity = velocity_[a];
+        const auto& measured = raw_[a];
+        for (size_t lane = 0; lane < HAND_JOINT_LANES; ++lane) {
+            const float predicted = position[lane] + velocity[lane] * dt;
+            const float residual = measured[lane] - predicted;
+            position[lane] = predicted + gains.alpha * residual;
+            velocity[lane] += betaRate * residual;
+            raw_[a][lane] = position[lane] + velocity[lane] * lookahead; // Output, reusing the input lanes
+        }
+    }
+    scatterHandJoints(raw_, hand);
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "HandData.hpp"
+#include "HandPoints.hpp"
+
+// Latency compensation: every joint of a hand extrapolated forward along its
+// estimated velocity, so a receiver sees where the hand is now rather than
+// where it was when the frame was captured.
+//
+// The estimate is an alpha-beta filter per lane (HandJointLanes), which is
+// the steady-state Kalman filter of a constant-velocity model. Constant
+// velocity mode uses gains of 1, i.e. the position as measured and the
+// velocity from the last two frames; Kalman mode derives the gains from the
+// noise settings and the frame interval, trading a little lag for steadier
+// velocities. A whole hand is one pass over fixed-length lanes.
+
+enum class PredictionMode : uint8_t { Off, ConstantVelocity, Kalman };
+
+const char* predictionModeToString(PredictionMode mode); // "off", "constant_velocity", "kalman"
+PredictionMode predictionModeFromString(const std::string& text); // Unknown text is Off
+
+struct PredictionConfig {
+    PredictionMode mode = PredictionMode::Off;
+    bool toSendTime = true;            // Add each frame's measured age to the lookahead
+    float lookaheadMs = 0.0f;          // Fixed lookahead on top of that
+    float maxExtrapolationMs = 30.0f;  // Clamp on the total lookahead
+    float accelerationNoise = 2000.0f; // Kalman: expected acceleration, mm/s^2
+    float measurementNoise = 1.0f;     // Kalman: tracking noise, mm
+};
+
+class HandPredictor {
+public:
+    // Forgets the estimate; the next apply() only takes its input.
+    void reset() { initialized_ = false; }
+
+    // Updates the estimate with the hand's joints and replaces them with
+    // their positions lookaheadUs later. A frame that is not newer than the
+    // previous one restarts the estimate, and a restarted estimate has no
+    // velocity yet, so the hand passes through unchanged.
+    void apply(HandData& hand, uint64_t timestampUs, uint64_t lookaheadUs, const PredictionConfig& config);
+
+private:
+    alignas(32) HandJointLanes raw_{};      // [axis][lane], this frame's input
+    alignas(32) HandJointLanes position_{}; // Estimated position
+    alignas(32) HandJointLanes velocity_{}; // Estimated velocity, mm/s
+
+    bool initialized_ = false;
+    uint64_t lastTimestampUs_ = 0;
+};
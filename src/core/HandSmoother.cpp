@@ -0,0 +1,131 @@
+#include "HandSmoother.hpp"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define HAND_SMOOTHER_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HAND_SMOOTHER_SSE 1
+#endif
+
+namespace {
+constexpr float TWO_PI = 6.28318530718f;
+
+// The few vector operations the filter needs, for the compiled-in width.
+#if defined(HAND_SMOOTHER_AVX)
+using Vec = __m256;
+constexpr size_t WIDTH = 8;
+inline Vec load(const float* p) { return _mm256_load_ps(p); }
+inline void store(float* p, Vec v) { _mm256_store_ps(p, v); }
+inline Vec set1(float f) { return _mm256_set1_ps(f); }
+inline Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+inline Vec sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+inline Vec mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+inline Vec div(Vec a, Vec b) { return _mm256_div_ps(a, b); }
+inline Vec abs(Vec a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+#elif defined(HAND_SMOOTHER_SSE)
+using Vec = __m128;
+constexpr size_t WIDTH = 4;
+inline Vec load(const float* p) { return _mm_load_ps(p); }
+inline void store(float* p, Vec v) { _mm_store_ps(p, v); }
+inline Vec set1(float f) { return _mm_set1_ps(f); }
+inline Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+inline Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+inline Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+inline Vec div(Vec a, Vec b) { return _mm_div_ps(a, b); }
+inline Vec abs(Vec a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+#else
+using Vec = float;
+constexpr size_t WIDTH = 1;
+inline Vec load(const float* p) { return *p; }
+inline void store(float* p, Vec v) { *p = v; }
+inline Vec set1(float f) { return f; }
+inline Vec add(Vec a, Vec b) { return a + b; }
+inline Vec sub(Vec a, Vec b) { return a - b; }
+inline Vec mul(Vec a, Vec b) { return a * b; }
+inline Vec div(Vec a, Vec b) { return a / b; }
+inline Vec abs(Vec a) { return a < 0 ? -a : a; }
+#endif
+static_assert(HandSmoother::LANES % WIDTH == 0, "lanes must fill whole vectors");
+
+// Smoothing factor of a first-order low-pass: r / (r + 1), r = 2*pi*cutoff*dt
+inline Vec smoothingFactor(Vec cutoff, Vec twoPiDt) {
+    const Vec r = mul(twoPiDt, cutoff);
+    return div(r, add(r, set1(1.0f)));
+}
+
+constexpr size_t PALM_LANE = 0;
+constexpr size_t WRIST_LANE = 1;
+}
+
+const char* smoothingGroupKey(SmoothingGroup group) {
+    switch (group) {
+        case SmoothingGroup::Palm:  return "palm";
+        case SmoothingGroup::Wrist: return "wrist";
+        default:                    return "fingers";
+    }
+}
+
+bool SmoothingConfig::anyEnabled() const {
+    for (const OneEuroParams& params : groups) {
+        if (params.enabled) return true;
+    }
+    return false;
+}
+
+void HandSmoother::configure(const SmoothingConfig& config) {
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        const SmoothingGroup group = lane == PALM_LANE ? SmoothingGroup::Palm
+                                   : lane == WRIST_LANE ? SmoothingGroup::Wrist
+                                   : SmoothingGroup::Fingers;
+        // Padding lanes stay disabled and pass their zeros through
+        const OneEuroParams& params = config[group];
+        const bool enabled = lane < POINTS && params.enabled;
+        minCutoff_[lane] = params.minCutoff;
+        beta_[lane] = params.beta;
+        dCutoff_[lane] = params.dCutoff;
+        enabled_[lane] = enabled ? 1.0f : 0.0f;
+        disabled_[lane] = enabled ? 0.0f : 1.0f;
+    }
+}
+
+void HandSmoother::apply(HandData& hand, uint64_t timestampUs) {
+    gatherHandJoints(hand, raw_);
+    if (!initialized_ || timestampUs <= lastTimestampUs_) {
+        value_ = raw_;
+        for (Lanes& speed : speed_) speed.fill(0.0f);
+        initialized_ = true;
+        lastTimestampUs_ = timestampUs;
+        scatterHandJoints(value_, hand); // Output equals input, with the bone chain made consistent
+        return;
+    }
+    const float dt = static_cast<float>(timestampUs - lastTimestampUs_) * 1e-6f;
+    lastTimestampUs_ = timestampUs;
+
+    const Vec rate = set1(1.0f / dt);
+    const Vec twoPiDt = set1(TWO_PI * dt);
+    for (size_t lane = 0; lane < LANES; lane += WIDTH) {
+        const Vec alphaSpeed = smoothingFactor(load(&dCutoff_[lane]), twoPiDt);
+        const Vec minCutoff = load(&minCutoff_[lane]);
+        const Vec beta = load(&beta_[lane]);
+        const Vec enabled = load(&enabled_[lane]);
+        const Vec disabled = load(&disabled_[lane]);
+        for (size_t a = 0; a < 3; ++a) {
+            const Vec x = load(&raw_[a][lane]);
+            Vec value = load(&value_[a][lane]);
+            Vec speed = load(&speed_[a][lane]);
+
+            // Filtered speed drives the cutoff of the position filter
+            const Vec rawSpeed = mul(sub(x, value), rate);
+            speed = add(speed, mul(alphaSpeed, sub(rawSpeed, speed)));
+            const Vec cutoff = add(minCutoff, mul(beta, abs(speed)));
+            // Disabled lanes get a factor of exactly 1, i.e. the raw value
+            const Vec alpha = add(mul(smoothingFactor(cutoff, twoPiDt), enabled), disabled);
+            value = add(value, mul(alpha, sub(x, value)));
+
+            store(&value_[a][lane], value);
+            store(&speed_[a][lane], speed);
+        }
+    }
+    scatterHandJoints(value_, hand);
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "HandData.hpp"
+#include "HandPoints.hpp"
+
+// One Euro filter (Casiez et al., CHI 2012) over every tracked point of one
+// hand: an adaptive low-pass whose cutoff rises with speed, so slow movement
+// loses its jitter and fast movement keeps little lag.
+//
+// State is kept as struct-of-arrays, one lane per point and one array per
+// axis, so a whole hand is filtered in a few SIMD passes: 8 lanes with AVX,
+// 4 with SSE2 (always available on x64), plain floats otherwise. The choice
+// is made at compile time (/arch:AVX2 or -mavx2 select AVX).
+
+// Groups that share filter parameters ("smoothing" in config.json).
+enum class SmoothingGroup : uint8_t { Palm, Wrist, Fingers, Count };
+constexpr size_t SMOOTHING_GROUP_COUNT = static_cast<size_t>(SmoothingGroup::Count);
+
+const char* smoothingGroupKey(SmoothingGroup group); // "palm", "wrist", "fingers"
+
+struct OneEuroParams {
+    bool enabled = false;
+    float minCutoff = 1.0f; // Hz; cutoff at rest, lower = smoother
+    float beta = 0.007f;    // Cutoff increase per mm/s of speed, higher = less lag
+    float dCutoff = 1.0f;   // Hz; cutoff for the speed estimate
+};
+
+struct SmoothingConfig {
+    std::array<OneEuroParams, SMOOTHING_GROUP_COUNT> groups;
+
+    const OneEuroParams& operator[](SmoothingGroup group) const { return groups[static_cast<size_t>(group)]; }
+    OneEuroParams& operator[](SmoothingGroup group) { return groups[static_cast<size_t>(group)]; }
+    bool anyEnabled() const;
+};
+
+class HandSmoother {
+public:
+    // Lanes: palm, wrist, then the next joint of each finger's four bones (see HandJointLanes).
+    static constexpr size_t POINTS = HAND_JOINT_POINTS;
+    static constexpr size_t LANES = HAND_JOINT_LANES;
+
+    // Takes new parameters; the filter state is kept.
+    void configure(const SmoothingConfig& config);
+    // Forgets the filter state; the next apply() passes its input through.
+    void reset() { initialized_ = false; }
+
+    // Replaces the hand's palm position, wrist position and bone joints with
+    // their filtered values. timestampUs is the frame time; a frame that is
+    // not newer than the previous one restarts the filter.
+    void apply(HandData& hand, uint64_t timestampUs);
+
+private:
+    using Lanes = std::array<float, LANES>;
+    alignas(32) HandJointLanes raw_{};   // [axis][lane], this frame's input
+    alignas(32) HandJointLanes value_{}; // Filtered position
+    alignas(32) HandJointLanes speed_{}; // Filtered derivative, mm/s
+
+    // Per-lane parameters, shared by the three axes
+    alignas(32) Lanes minCutoff_{};
+    alignas(32) Lanes beta_{};
+    alignas(32) Lanes dCutoff_{};
+    alignas(32) Lanes enabled_{};  // 1 = filtered, 0 = passed through
+    alignas(32) Lanes disabled_{}; // 1 - enabled_
+
+    bool initialized_ = false;
+    uint64_t lastTimestampUs_ = 0;
+};
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "HandData.hpp"
+
+// Per-hand state (filters, prediction, gestures) keyed by the tracker's hand
+// id rather than by left/right, so two hands of one type, or a hand the
+// tracker re-detects under a new id, never share or inherit state.
+//
+// A fixed number of entries, searched linearly: a device tracks a handful of
+// hands, so the per-frame path neither hashes nor allocates. Entries are
+// marked when acquired in a frame; evictUnseen() drops the rest. Whatever
+// evicts an entry implicitly (evictUnseen(), acquire() on a full table)
+// hands it to an onEvict callback first, so the owner can wind its state
+// down (e.g. end a gesture in progress).
+
+// The key a hand's state is filed under. LeapC ids start at 1; hands without
+// one (id 0, e.g. synthesized frames) get a reserved key per hand type, so
+// left and right still keep separate state.
+constexpr uint32_t NO_HAND_KEY = 0;
+inline uint32_t handStateKey(const HandData& hand) {
+    return hand.id != 0 ? hand.id : 0xFFFFFF00u + static_cast<uint32_t>(hand.handType);
+}
+
+template <typename State, size_t Capacity>
+class HandStateTable {
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    // Starts a frame: entries acquired from here on count as seen in it.
+    void beginFrame() { ++frame_; }
+
+    State* find(uint32_t key) {
+        for (Entry& entry : entries_) {
+            if (entry.key == key && key != NO_HAND_KEY) return &entry.state;
+        }
+        return nullptr;
+    }
+
+    // The state filed under key, marked seen. A key without an entry takes a
+    // free one, or when full the one seen longest ago (passed to
+    // onEvict(key, state) first), reset to State{}; isNew tells the caller
+    // to initialize it.
+    template <typename OnEvict>
+    State& acquire(uint32_t key, bool& isNew, OnEvict&& onEvict) {
+        Entry* slot = nullptr;
+        for (Entry& entry : entries_) {
+            if (entry.key == key) {
+                entry.seenFrame = frame_;
+                isNew = false;
+                return entry.state;
+            }
+            if (!slot || (slot->key != NO_HAND_KEY && (entry.key == NO_HAND_KEY || entry.seenFrame < slot->seenFrame))) {
+                slot = &entry;
+            }
+        }
+        if (slot->key != NO_HAND_KEY) onEvict(slot->key, slot->state);
+        slot->key = key;
+        slot->seenFrame = frame_;
+        slot->state = State{};
+        isNew = true;
+        return slot->state;
+    }
+
+    void evict(uint32_t key) {
+        for (Entry& entry : entries_) {
+            if (entry.key == key) entry.key = NO_HAND_KEY;
+        }
+    }
+
+    // Evicts every entry not acquired since beginFrame() unless keep(key)
+    // says otherwise, passing each to onEvict(key, state) first.
+    template <typename Keep, typename OnEvict>
+    void evictUnseen(Keep&& keep, OnEvict&& onEvict) {
+        for (Entry& entry : entries_) {
+            if (entry.key != NO_HAND_KEY && entry.seenFrame != frame_ && !keep(entry.key)) {
+                onEvict(entry.key, entry.state);
+                entry.key = NO_HAND_KEY;
+            }
+        }
+    }
+
+    template <typename F>
+    void forEach(F&& f) {
+        for (Entry& entry : entries_) {
+            if (entry.key != NO_HAND_KEY) f(entry.state);
+        }
+    }
+
+    void clear() {
+        for (Entry& entry : entries_) entry.key = NO_HAND_KEY;
+    }
+
+    size_t size() const {
+        size_t count = 0;
+        for (const Entry& entry : entries_) count += entry.key != NO_HAND_KEY;
+        return count;
+    }
+
+private:
+    struct Entry {
+        uint32_t key = NO_HAND_KEY;
+        uint64_t seenFrame = 0;
+        State state;
+    };
+    std::array<Entry, Capacity> entries_{};
+    uint64_t frame_ = 0;
+};
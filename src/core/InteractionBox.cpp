@@ -0,0 +1,67 @@
+#include "InteractionBox.hpp"
+#include <algorithm>
+#include <limits>
+
+void BoxNormalizer::configure(const InteractionBox& box, bool learn) {
+    box_ = box;
+    learn_ = learn;
+    if (!learn_) reset();
+    updateAffine();
+}
+
+void BoxNormalizer::reset() {
+    seenMin_.fill(std::numeric_limits<float>::max());
+    seenMax_.fill(std::numeric_limits<float>::lowest());
+    updateAffine();
+}
+
+void BoxNormalizer::updateAffine() {
+    for (size_t a = 0; a < 3; ++a) {
+        float lo = *vectorAxis(box_.min, a);
+        float hi = *vectorAxis(box_.max, a);
+        if (learn_ && seenMax_[a] - seenMin_[a] >= MIN_LEARNED_EXTENT_MM) {
+            lo = seenMin_[a];
+            hi = seenMax_[a];
+        }
+        offset_[a] = lo;
+        scale_[a] = 1.0f / (std::max)(hi - lo, 1e-3f);
+    }
+}
+
+Vector3 BoxNormalizer::size() const {
+    return { 1.0f / scale_[0], 1.0f / scale_[1], 1.0f / scale_[2] };
+}
+
+void BoxNormalizer::normalize(const HandPointPositions& points, DerivedHandData& out) {
+    if (learn_) {
+        bool grew = false;
+        for (size_t a = 0; a < 3; ++a) {
+            float lo = seenMin_[a];
+            float hi = seenMax_[a];
+            for (size_t lane = 0; lane < HAND_POINT_LANES; ++lane) {
+                // Invalid and padding lanes don't count as observed
+                const float p = points.position[a][lane];
+                lo = points.valid[lane] > 0.0f ? (std::min)(lo, p) : lo;
+                hi = points.valid[lane] > 0.0f ? (std::max)(hi, p) : hi;
+            }
+            grew |= lo != seenMin_[a] || hi != seenMax_[a];
+            seenMin_[a] = lo;
+            seenMax_[a] = hi;
+        }
+        if (grew) updateAffine();
+    }
+
+    // One clamped affine transform over all lanes per axis
+    std::array<HandPointLanes, 3> normalized;
+    for (size_t a = 0; a < 3; ++a) {
+        const float offset = offset_[a];
+        const float scale = scale_[a];
+        for (size_t lane = 0; lane < HAND_POINT_LANES; ++lane) {
+            const float n = (points.position[a][lane] - offset) * scale;
+            normalized[a][lane] = (std::min)(1.0f, (std::max)(0.0f, n));
+        }
+    }
+    for (size_t p = 0; p < HAND_POINT_COUNT; ++p) {
+        for (size_t a = 0; a < 3; ++a) *vectorAxis(out.normalized[p], a) = normalized[a][p];
+    }
+}
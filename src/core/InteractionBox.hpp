@@ -0,0 +1,45 @@
+#pragma once
+#include <array>
+#include "HandPoints.hpp"
+#include "DerivedHandData.hpp"
+
+// Region of tracker space, in millimetres, that normalized output maps to
+// 0-1 on each axis. The default covers the comfortable range above one
+// Leap Motion Controller.
+struct InteractionBox {
+    Vector3 min = {-150.f, 80.f, -120.f};
+    Vector3 max = {150.f, 380.f, 120.f};
+};
+
+// Maps one device's hand points into its interaction box: either a fixed box,
+// or, with learning on, the extents the device's points have covered so far.
+// A learned axis is used once it spans MIN_LEARNED_EXTENT_MM; until then that
+// axis falls back to the fixed box.
+class BoxNormalizer {
+public:
+    static constexpr float MIN_LEARNED_EXTENT_MM = 50.0f;
+
+    BoxNormalizer() { configure(InteractionBox(), false); }
+
+    // Learned extents are kept across calls; reset() forgets them.
+    void configure(const InteractionBox& box, bool learn);
+    void reset();
+
+    // Extends the learned extents with the valid points (when learning) and
+    // writes every point, clamped to 0-1, to out.normalized.
+    void normalize(const HandPointPositions& points, DerivedHandData& out);
+
+    // Size of the box in use, in millimetres.
+    Vector3 size() const;
+
+private:
+    void updateAffine();
+
+    InteractionBox box_;
+    bool learn_ = false;
+    std::array<float, 3> seenMin_{};
+    std::array<float, 3> seenMax_{};
+    // n = (p - offset_) * scale_, per axis
+    std::array<float, 3> offset_{};
+    std::array<float, 3> scale_{};
+};
@@ -0,0 +1,30 @@
+#include "LatestFrameStore.hpp"
+
+bool LatestFrameStore::publish(const FrameData& frame) {
+    const uint8_t slot = slots_.findOrAssign(frame.deviceId);
+    if (slot == INVALID_DEVICE_SLOT) return false;
+
+    toSnapshot(frame, writeScratch_);
+    frames_[slot].store(writeScratch_);
+    latestSlot_.store(slot, std::memory_order_release);
+    return true;
+}
+
+bool LatestFrameStore::getLatest(FrameData& outFrame) const {
+    return loadSlot(latestSlot_.load(std::memory_order_acquire), outFrame);
+}
+
+bool LatestFrameStore::getLatest(const std::string& deviceId, FrameData& outFrame) const {
+    const uint8_t slot = slots_.find(deviceId);
+    return loadSlot(slot == INVALID_DEVICE_SLOT ? -1 : slot, outFrame);
+}
+
+bool LatestFrameStore::loadSlot(int slot, FrameData& outFrame) const {
+    if (slot < 0) return false;
+    // Thread-local so concurrent readers don't share a buffer and the ~5 KB
+    // snapshot stays off the caller's stack.
+    thread_local FrameSnapshot snapshot;
+    if (!frames_[slot].load(snapshot)) return false;
+    fromSnapshot(snapshot, outFrame);
+    return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <string>
+#include "FrameData.hpp"
+#include "FrameSnapshot.hpp"
+#include "DeviceSlotTable.hpp"
+#include "../utils/SeqLock.h"
+
+// Latest tracking frame per device, written by the poll thread and readable
+// from any thread without locks.
+//
+// Each device gets a fixed slot (DeviceSlotTable) holding a
+// SeqLock<FrameSnapshot>, so the writer never blocks and readers always see
+// one complete frame. Devices beyond MAX_TRACKED_DEVICES are not stored.
+class LatestFrameStore {
+public:
+    LatestFrameStore() = default;
+    LatestFrameStore(const LatestFrameStore&) = delete;
+    LatestFrameStore& operator=(const LatestFrameStore&) = delete;
+
+    // Writer (poll thread) only. Returns false if the device has no slot.
+    bool publish(const FrameData& frame);
+
+    // Most recently published frame of any device.
+    bool getLatest(FrameData& outFrame) const;
+    // Most recently published frame of one device.
+    bool getLatest(const std::string& deviceId, FrameData& outFrame) const;
+
+    size_t deviceCount() const { return slots_.size(); }
+
+private:
+    bool loadSlot(int slot, FrameData& outFrame) const;
+
+    DeviceSlotTable slots_;
+    std::array<SeqLock<FrameSnapshot>, MAX_TRACKED_DEVICES> frames_;
+    std::atomic<int> latestSlot_{-1};
+
+    FrameSnapshot writeScratch_; // Writer-side conversion buffer
+};
@@ -3,20 +3,20 @@
 #include <LeapC.h> // For LeapC API (Hyperion/v6) -- event handle API not available
 #include <chrono>
 #include <thread>
-#include "../utils/SpscQueue.hpp"
+#include "../utils/ThreadAffinity.h"
 #include <windows.h>
 #include <memory>
 
-LeapInput::LeapInput(LEAP_CONNECTION connection, std::shared_ptr<SpscQueue<FrameData>> queue)
+LeapInput::LeapInput(LEAP_CONNECTION connection, std::shared_ptr<FrameChannel> frameChannel)
     : poller_(std::make_unique<LeapPoller>(connection))
-    , frameQueue_(std::move(queue))
+    , frameChannel_(std::move(frameChannel))
 {
     // Add logging here *before* the check
-    OutputDebugStringA(frameQueue_ ? "LeapInput: Received VALID queue shared_ptr.\n" : "LeapInput: Received NULL queue shared_ptr!\n");
+    OutputDebugStringA(frameChannel_ ? "LeapInput: Received VALID frame channel shared_ptr.\n" : "LeapInput: Received NULL frame channel shared_ptr!\n");
 
-    if (!frameQueue_) {
-        // Handle error: queue pointer cannot be null
-        throw std::invalid_argument("LeapInput: SpscQueue shared_ptr cannot be null.");
+    if (!frameChannel_) {
+        // Handle error: channel pointer cannot be null
+        throw std::invalid_argument("LeapInput: FrameChannel shared_ptr cannot be null.");
     }
     if (onDeviceConnected_) poller_->setDeviceConnectedCallback(onDeviceConnected_);
     if (onDeviceLost_) poller_->setDeviceLostCallback(onDeviceLost_);
@@ -30,43 +30,41 @@ void LeapInput::setFrameCallback(FrameCallback cb) {
 
 // IFrameSource implementation
 bool LeapInput::getNextFrame(FrameData& outFrame) {
-    std::lock_guard<std::mutex> lock(latestFrameMutex_);
-    if (!hasFrame_) return false;
-    outFrame = latestFrame_;
-    return true;
+    return latestFrames_.getLatest(outFrame);
+}
+
+bool LeapInput::getLatestFrame(const std::string& deviceId, FrameData& outFrame) {
+    return latestFrames_.getLatest(deviceId, outFrame);
 }
 
 void LeapInput::start() {
     if (poller_) {
         poller_->initializeDevices();
-        poller_->setFrameCallback([this, localFrameQueue = this->frameQueue_](const FrameData& frameData) {
-            // Store latest frame for IFrameSource (optional, depends if needed)
-            {
-                std::lock_guard<std::mutex> lock(latestFrameMutex_);
-                latestFrame_ = frameData;
-                hasFrame_ = true;
-            }
+        poller_->setFrameCallback([this, localFrameChannel = this->frameChannel_](const FrameData& frameData) {
+            // Store latest frame for IFrameSource; never blocks on readers
+            latestFrames_.publish(frameData);
 
             // Log that the callback is attempting to push
 #ifdef VERBOSE_LEAP_LOGGING
             static int frameCbLogCounter = 0;
             if (++frameCbLogCounter % 100 == 0) {
-                OutputDebugStringA(("LeapInput frame callback invoked for SN: " + frameData.deviceId + ". Attempting to push to queue.\n").c_str());
+                OutputDebugStringA(("LeapInput frame callback invoked for SN: " + frameData.deviceId + ". Attempting to publish to frame channel.\n").c_str());
             }
 #endif
 
-            // --- Push frame data onto the SPSC queue using the captured shared_ptr --- 
-            if (localFrameQueue) { // Check captured pointer validity
-                if (!localFrameQueue->try_push(frameData)) { // Push a copy
-                     // Log or handle queue full condition
+            // --- Hand the frame to the main loop through the frame channel ---
+            // The channel copies into a recycled frame and applies the overflow
+            // policy; drops are counted per device and reported by AppCore.
+            if (localFrameChannel) { // Check captured pointer validity
+                if (!localFrameChannel->publish(frameData)) {
 #ifdef VERBOSE_LEAP_LOGGING
-                     OutputDebugStringA("Warning: Leap SPSC frame queue full. Frame dropped.\n");
+                     OutputDebugStringA("Warning: Leap frame channel full. Frame dropped.\n");
 #endif
                 }
             } else {
                  // This case should ideally not happen if initialization is correct
 #ifdef VERBOSE_LEAP_LOGGING
-                 OutputDebugStringA("Error: LeapInput frame callback lambda has null queue pointer!\n");
+                 OutputDebugStringA("Error: LeapInput frame callback lambda has null frame channel pointer!\n");
 #endif
             }
         });
@@ -74,6 +72,7 @@ void LeapInput::start() {
     running_ = true;
     OutputDebugStringA("LeapInput::start() - Creating poll thread...\n");
     pollThread_ = std::thread([this]() { pollLoop(); });
+    threadPlacementReport_ = ThreadAffinity::applyPlacement(pollThread_, ThreadNames::LeapPoll, threadPlacement_);
     OutputDebugStringA("LeapInput::start() - Poll thread created.\n");
 }
 
@@ -117,6 +116,10 @@ void LeapInput::pollLoop() {
 #ifdef VERBOSE_LEAP_LOGGING
     OutputDebugStringA("LeapInput::pollLoop() - Thread started.\n");
 #endif
+    if (inputConfig_.mode == InputMode::Interpolated) {
+        interpolationLoop();
+        return;
+    }
     // --- Polling loop for LeapC Hyperion (v6) ---
     // Event-driven waiting via event handle is not available in Hyperion/v6 SDK.
     // Use a simple polling loop with a short sleep to reduce CPU usage.
@@ -154,6 +157,29 @@ void LeapInput::pollLoop() {
 #endif
 }
 
+// Samples every device at evenly spaced ticks. Tracking events still arrive
+// on the connection and are drained (unforwarded) between ticks, along with
+// the device and connection events that must still be handled.
+void LeapInput::interpolationLoop() {
+    poller_->setForwardTrackingEvents(false);
+    FixedRateClock clock(inputConfig_.rateHz);
+    // Ticks are scheduled on the steady clock and sampled on LeapC's clock;
+    // the offset between them is taken once, so sample times stay exactly one
+    // period apart rather than picking up wake-up jitter.
+    const int64_t startNs = FixedRateClock::now();
+    const int64_t leapOffsetUs = LeapGetNow() - startNs / 1000;
+    const int64_t delayUs = static_cast<int64_t>(inputConfig_.delayMs * 1000.0f);
+    clock.reset(startNs);
+    while (running_.load()) {
+        const int64_t tickNs = clock.wait();
+        for (int i = 0; i < 64; ++i) { // Bounded, so a flood of events cannot stall the ticks
+            if (!poller_->poll(0)) break;
+        }
+        poller_->sampleAt(tickNs / 1000 + leapOffsetUs - delayUs);
+    }
+    poller_->setForwardTrackingEvents(true);
+}
+
 // These would be called by Leap event handlers. You need to call them from the relevant Leap events.
 void LeapInput::onLeapServiceConnect() {
     if (onConnect_) {
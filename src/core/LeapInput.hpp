@@ -4,6 +4,9 @@
 #include "ConnectEvent.hpp"
 #include "DisconnectEvent.hpp"
 #include "FrameData.hpp"
+#include "LatestFrameStore.hpp"
+#include "FrameChannel.hpp"
+#include "FixedRateClock.hpp"
 #include <mutex>
 #include <thread>
 #include <atomic>
@@ -15,7 +18,7 @@
 
 #include "interfaces/IFrameSource.hpp"
 
-#include "../utils/SpscQueue.hpp"
+#include "../utils/ThreadPlacement.h"
 
 class LeapInput : public IFrameStreamingInputDevice, public LeapPoller::LeapInputCallback, public IFrameSource {
 public:
@@ -28,7 +31,7 @@ public:
     // Use the updated signature from LeapPoller
     using DeviceLostCallback = LeapPoller::DeviceLostCallback;
 
-    LeapInput(LEAP_CONNECTION connection, std::shared_ptr<SpscQueue<FrameData>> queue);
+    LeapInput(LEAP_CONNECTION connection, std::shared_ptr<FrameChannel> frameChannel);
     // Update signature to match IInputDevice and mark override
     void setFrameCallback(FrameCallback cb) override;
     void start() override;
@@ -48,22 +51,34 @@ public:
     void setDeviceLostCallback(DeviceLostCallback cb) override;
     void setConnectCallback(ConnectCallback cb);
     void setDisconnectCallback(DisconnectCallback cb);
+
+    // Placement for the poll thread; applied when start() creates it.
+    void setThreadPlacement(const ThreadPlacement& placement) { threadPlacement_ = placement; }
+    const std::string& getThreadPlacementReport() const { return threadPlacementReport_; }
+
+    // Event-driven (a frame per tracking event) or interpolated at a fixed
+    // rate; applied when start() creates the poll thread.
+    void setInputConfig(const InputConfig& config) { inputConfig_ = config; }
+    const InputConfig& getInputConfig() const { return inputConfig_; }
 private:
     std::unique_ptr<LeapPoller> poller_;
     FrameCallback highLevelCallback_;
-    std::shared_ptr<SpscQueue<FrameData>> frameQueue_;
+    std::shared_ptr<FrameChannel> frameChannel_; // Frames go out via publish(), come back via the consumer's release()
     DeviceConnectedCallback onDeviceConnected_;
     DeviceLostCallback onDeviceLost_;
     std::atomic<bool> running_{false};
     std::thread pollThread_;
+    ThreadPlacement threadPlacement_;
+    std::string threadPlacementReport_;
+    InputConfig inputConfig_;
     void pollLoop();
+    void interpolationLoop();
     ConnectCallback onConnect_;
     DisconnectCallback onDisconnect_;
-    // For IFrameSource
-    std::mutex latestFrameMutex_;
-    FrameData latestFrame_;
-    bool hasFrame_ = false;
+    // For IFrameSource: lock-free latest frame per device, written by the poll thread
+    LatestFrameStore latestFrames_;
 public:
     // IFrameSource implementation
     bool getNextFrame(FrameData& outFrame) override;
+    bool getLatestFrame(const std::string& deviceId, FrameData& outFrame) override;
 };
@@ -0,0 +1,215 @@
+#include "OscFieldRegistry.hpp"
+#include <cstddef>
+
+namespace {
+static_assert(sizeof(DerivedHandData::flexion) == 15 * sizeof(float), "flexion must be contiguous");
+
+// std::array elements are laid out like a C array, so finger/bone offsets can be computed.
+static_assert(sizeof(HandData::fingers) == 5 * sizeof(FingerData), "fingers must be contiguous");
+static_assert(sizeof(FingerData::bones) == 4 * sizeof(BoneData), "bones must be contiguous");
+
+constexpr uint32_t PALM = offsetof(HandData, palm);
+constexpr uint32_t ARM = offsetof(HandData, arm);
+
+uint32_t vectorOffset(uint32_t base, char axis) {
+    return base + (axis == 'x' ? offsetof(Vector3, x) : axis == 'y' ? offsetof(Vector3, y) : offsetof(Vector3, z));
+}
+
+uint32_t fingerOffset(size_t finger) {
+    return static_cast<uint32_t>(offsetof(HandData, fingers) + finger * sizeof(FingerData));
+}
+
+uint32_t cursorOffset(HandPoint point) {
+    return static_cast<uint32_t>(offsetof(DerivedHandData, cursor) + static_cast<size_t>(point) * sizeof(Vector3));
+}
+
+uint32_t normalizedOffset(HandPoint point) {
+    return static_cast<uint32_t>(offsetof(DerivedHandData, normalized) + static_cast<size_t>(point) * sizeof(Vector3));
+}
+
+uint32_t derivedOffset(size_t member, size_t index = 0) {
+    return static_cast<uint32_t>(member + index * sizeof(float));
+}
+
+uint32_t fingerTipOffset(size_t finger) {
+    return static_cast<uint32_t>(fingerOffset(finger) + offsetof(FingerData, bones) + 3 * sizeof(BoneData) + offsetof(BoneData, nextJoint));
+}
+
+const char* const FINGER_NAMES[5] = { "thumb", "index", "middle", "ring", "pinky" };
+const OscField FINGER_FIELDS[5] = { OscField::Thumb, OscField::Index, OscField::Middle, OscField::Ring, OscField::Pinky };
+
+std::vector<OscChannel> buildChannels() {
+    std::vector<OscChannel> channels;
+    auto add = [&](OscField field, std::string address, uint32_t offset, OscValueKind kind, uint8_t guard, bool zeroOnLoss) {
+        channels.push_back({ field, std::move(address), offset, kind, guard, zeroOnLoss });
+    };
+    auto addVector = [&](OscField field, const std::string& prefix, uint32_t base, uint8_t guard, bool zeroOnLoss) {
+        add(field, prefix + "x", vectorOffset(base, 'x'), OscValueKind::Float, guard, zeroOnLoss);
+        add(field, prefix + "y", vectorOffset(base, 'y'), OscValueKind::Float, guard, zeroOnLoss);
+        add(field, prefix + "z", vectorOffset(base, 'z'), OscValueKind::Float, guard, zeroOnLoss);
+    };
+    // A point position: millimetres from HandData, and the same point normalized
+    auto addPoint = [&](OscField field, const std::string& prefix, uint32_t base, HandPoint point, uint8_t guard) {
+        for (char a : { 'x', 'y', 'z' }) {
+            channels.push_back({ field, prefix + "t" + a, vectorOffset(base, a), OscValueKind::Float, guard, true,
+                                 OscSource::Hand, OscField::Count, OscSpace::Raw });
+        }
+        for (char a : { 'x', 'y', 'z' }) {
+            channels.push_back({ field, prefix + "norm/" + a, vectorOffset(normalizedOffset(point), a), OscValueKind::Float, guard, true,
+                                 OscSource::Derived, OscField::Count, OscSpace::Normalized });
+        }
+    };
+
+    // Positions, in millimetres and normalized (see PositionOutput)
+    addPoint(OscField::Palm, "palm/", PALM + offsetof(PalmData, position), HandPoint::Palm, OSC_GUARD_NONE);
+    addPoint(OscField::Wrist, "wrist/", ARM + offsetof(ArmData, wristPosition), HandPoint::Wrist, OSC_GUARD_ARM);
+    add(OscField::PinchStrength, "pinchStrength", offsetof(HandData, pinchStrength), OscValueKind::Float, OSC_GUARD_NONE, true);
+    add(OscField::GrabStrength, "grabStrength", offsetof(HandData, grabStrength), OscValueKind::Float, OSC_GUARD_NONE, true);
+    for (size_t f = 0; f < 5; ++f) {
+        const std::string prefix = std::string("finger/") + FINGER_NAMES[f] + "/";
+        const uint8_t guard = static_cast<uint8_t>(OSC_GUARD_FINGER + f);
+        addPoint(FINGER_FIELDS[f], prefix, fingerTipOffset(f), static_cast<HandPoint>(static_cast<size_t>(HandPoint::Thumb) + f), guard);
+        add(FINGER_FIELDS[f], prefix + "exists", 0, OscValueKind::ZeroOnly, OSC_GUARD_NONE, true);
+        add(OscField::FingerIsExtended, prefix + "isExtended", fingerOffset(f) + offsetof(FingerData, isExtended), OscValueKind::Flag, guard, true);
+    }
+    const uint32_t orientation = PALM + offsetof(PalmData, orientation);
+    add(OscField::PalmOrientation, "palm/orientation/qw", orientation + offsetof(Quaternion, w), OscValueKind::Float, OSC_GUARD_NONE, false);
+    add(OscField::PalmOrientation, "palm/orientation/qx", orientation + offsetof(Quaternion, x), OscValueKind::Float, OSC_GUARD_NONE, false);
+    add(OscField::PalmOrientation, "palm/orientation/qy", orientation + offsetof(Quaternion, y), OscValueKind::Float, OSC_GUARD_NONE, false);
+    add(OscField::PalmOrientation, "palm/orientation/qz", orientation + offsetof(Quaternion, z), OscValueKind::Float, OSC_GUARD_NONE, false);
+    addVector(OscField::PalmVelocity, "palm/velocity/v", PALM + offsetof(PalmData, velocity), OSC_GUARD_NONE, false);
+    addVector(OscField::PalmNormal, "palm/normal/n", PALM + offsetof(PalmData, normal), OSC_GUARD_NONE, false);
+    add(OscField::VisibleTime, "visibleTime", offsetof(HandData, visibleTime), OscValueKind::Microseconds, OSC_GUARD_NONE, true);
+
+    // Relative cursors (PointerGain), for the points whose position is enabled
+    auto addCursor = [&](OscField pointField, const std::string& prefix, HandPoint point, uint8_t guard) {
+        for (char a : { 'x', 'y', 'z' }) {
+            channels.push_back({ OscField::Cursor, prefix + "cursor/" + a, vectorOffset(cursorOffset(point), a),
+                                 OscValueKind::Float, guard, false, OscSource::Derived, pointField });
+        }
+    };
+    addCursor(OscField::Palm, "palm/", HandPoint::Palm, OSC_GUARD_NONE);
+    addCursor(OscField::Wrist, "wrist/", HandPoint::Wrist, OSC_GUARD_ARM);
+    for (size_t f = 0; f < 5; ++f) {
+        addCursor(FINGER_FIELDS[f], std::string("finger/") + FINGER_NAMES[f] + "/",
+                  static_cast<HandPoint>(static_cast<size_t>(HandPoint::Thumb) + f), static_cast<uint8_t>(OSC_GUARD_FINGER + f));
+    }
+
+    // Biomechanics (HandFeatures)
+    auto addDerived = [&](OscField field, std::string address, uint32_t offset, uint8_t guard) {
+        channels.push_back({ field, std::move(address), offset, OscValueKind::Float, guard, false, OscSource::Derived });
+    };
+    const char* const JOINT_NAMES[3] = { "mcp", "pip", "dip" };
+    for (size_t f = 0; f < 5; ++f) {
+        const std::string prefix = std::string("finger/") + FINGER_NAMES[f] + "/";
+        const uint8_t guard = static_cast<uint8_t>(OSC_GUARD_FINGER + f);
+        for (size_t j = 0; j < 3; ++j) {
+            addDerived(OscField::FingerFlexion, prefix + "flexion/" + JOINT_NAMES[j],
+                       derivedOffset(offsetof(DerivedHandData, flexion), f * 3 + j), guard);
+        }
+        addDerived(OscField::FingerCurl, prefix + "curl", derivedOffset(offsetof(DerivedHandData, curl), f), guard);
+    }
+    const char* const SPREAD_NAMES[4] = { "thumbIndex", "indexMiddle", "middleRing", "ringPinky" };
+    for (size_t s = 0; s < 4; ++s) {
+        addDerived(OscField::FingerSpread, std::string("spread/") + SPREAD_NAMES[s],
+                   derivedOffset(offsetof(DerivedHandData, spread), s), OSC_GUARD_NONE);
+    }
+    addDerived(OscField::PalmAngles, "palm/roll", offsetof(DerivedHandData, palmRoll), OSC_GUARD_NONE);
+    addDerived(OscField::PalmAngles, "palm/pitch", offsetof(DerivedHandData, palmPitch), OSC_GUARD_NONE);
+    addDerived(OscField::PalmAngles, "palm/yaw", offsetof(DerivedHandData, palmYaw), OSC_GUARD_NONE);
+    addDerived(OscField::Openness, "openness", offsetof(DerivedHandData, openness), OSC_GUARD_NONE);
+
+    // Static pose (PoseClassifier); zeroed on loss, id 0 being "no pose"
+    channels.push_back({ OscField::Pose, "pose/id", offsetof(DerivedHandData, poseId), OscValueKind::Float, OSC_GUARD_NONE, true, OscSource::Derived });
+    channels.push_back({ OscField::Pose, "pose/score", offsetof(DerivedHandData, poseScore), OscValueKind::Float, OSC_GUARD_NONE, true, OscSource::Derived });
+    return channels;
+}
+}
+
+const std::array<OscFieldInfo, OSC_FIELD_COUNT>& oscFields() {
+    static const std::array<OscFieldInfo, OSC_FIELD_COUNT> fields = {{
+        { OscField::Palm,             "sendPalm",             "Send Palm",               true  },
+        { OscField::Wrist,            "sendWrist",            "Send Wrist",              true  },
+        { OscField::Thumb,            "sendThumb",            "Send Thumb",              true  },
+        { OscField::Index,            "sendIndex",            "Send Index Finger",       true  },
+        { OscField::Middle,           "sendMiddle",           "Send Middle Finger",      true  },
+        { OscField::Ring,             "sendRing",             "Send Ring Finger",        true  },
+        { OscField::Pinky,            "sendPinky",            "Send Pinky Position",     true  },
+        { OscField::FingerIsExtended, "sendFingerIsExtended", "Send Finger Is Extended", false },
+        { OscField::PalmOrientation,  "sendPalmOrientation",  "Send Palm Orientation",   false },
+        { OscField::PalmVelocity,     "sendPalmVelocity",     "Send Palm Velocity",      false },
+        { OscField::PalmNormal,       "sendPalmNormal",       "Send Palm Normal",        false },
+        { OscField::VisibleTime,      "sendVisibleTime",      "Send Visible Time",       false },
+        { OscField::PinchStrength,    "sendPinchStrength",    "Send Pinch Strength",     true  },
+        { OscField::GrabStrength,     "sendGrabStrength",     "Send Grab Strength",      true  },
+        { OscField::Cursor,           "sendCursor",           "Send Relative Cursors",   false },
+        // No channels: sent by DataProcessor as one blob per hand (SkeletonPacket.hpp)
+        { OscField::Skeleton,         "sendSkeleton",         "Send Skeleton Blob",      false },
+        { OscField::FingerFlexion,    "sendFingerFlexion",    "Send Finger Flexion",     false },
+        { OscField::FingerCurl,       "sendFingerCurl",       "Send Finger Curl",        false },
+        { OscField::FingerSpread,     "sendFingerSpread",     "Send Finger Spread",      false },
+        { OscField::PalmAngles,       "sendPalmAngles",       "Send Palm Angles",        false },
+        { OscField::Openness,         "sendOpenness",         "Send Hand Openness",      false },
+        // No channels: triggers sent by DataProcessor's event path (GestureDetector.hpp)
+        { OscField::Gestures,         "sendGestures",         "Send Gesture Events",     false },
+        { OscField::Pose,             "sendPose",             "Send Pose",               false },
+    }};
+    return fields;
+}
+
+OscFieldMask defaultOscFieldMask() {
+    OscFieldMask mask = 0;
+    for (const OscFieldInfo& info : oscFields()) {
+        if (info.enabledByDefault) mask |= oscFieldBit(info.field);
+    }
+    return mask;
+}
+
+const std::vector<OscChannel>& oscChannels() {
+    static const std::vector<OscChannel> channels = buildChannels();
+    return channels;
+}
+
+uint32_t handValidity(const HandData& hand) {
+    uint32_t valid = 0;
+    if (hand.arm.isValid()) valid |= 1u << OSC_GUARD_ARM;
+    for (size_t f = 0; f < 5; ++f) {
+        if (hand.fingers[f].isValid() && hand.fingers[f].bones[3].isValid()) {
+            valid |= 1u << (OSC_GUARD_FINGER + f);
+        }
+    }
+    return valid;
+}
+
+const char* positionOutputToString(PositionOutput output) {
+    switch (output) {
+        case PositionOutput::Normalized: return "normalized";
+        case PositionOutput::Both:       return "both";
+        default:                         return "raw";
+    }
+}
+
+PositionOutput positionOutputFromString(const std::string& value) {
+    if (value == "normalized") return PositionOutput::Normalized;
+    if (value == "both") return PositionOutput::Both;
+    return PositionOutput::Raw;
+}
+
+OscEmissionPlan compileEmissionPlan(OscFieldMask fields, PositionOutput positions) {
+    const bool raw = positions != PositionOutput::Normalized;
+    const bool normalized = positions != PositionOutput::Raw;
+    OscEmissionPlan plan;
+    const auto& channels = oscChannels();
+    for (size_t id = 0; id < channels.size(); ++id) {
+        const OscChannel& channel = channels[id];
+        if (!(fields & oscFieldBit(channel.field))) continue;
+        if (channel.pointField != OscField::Count && !(fields & oscFieldBit(channel.pointField))) continue;
+        if ((channel.space == OscSpace::Raw && !raw) || (channel.space == OscSpace::Normalized && !normalized)) continue;
+        const uint16_t addressId = static_cast<uint16_t>(id);
+        if (channel.kind != OscValueKind::ZeroOnly) {
+            plan.live.push_back({ channel.sourceOffset, addressId, channel.kind, channel.guard, channel.source });
+        }
+        if (channel.zeroOnLoss) plan.zeroOnLoss.push_back(addressId);
+    }
+    return plan;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "HandData.hpp"
+#include "DerivedHandData.hpp"
+
+// Every value DataProcessor can send per hand ("channels"), and the user-facing
+// switches ("fields") that turn groups of them on.
+//
+// Adding a value means adding one row to oscChannels() in OscFieldRegistry.cpp.
+// Adding a switch means adding one enum value and one row to oscFields(). Config,
+// UI and DataProcessor pick both up from here.
+
+enum class OscField : uint8_t {
+    Palm, Wrist, Thumb, Index, Middle, Ring, Pinky,
+    FingerIsExtended, PalmOrientation, PalmVelocity, PalmNormal, VisibleTime,
+    PinchStrength, GrabStrength, Cursor, Skeleton,
+    FingerFlexion, FingerCurl, FingerSpread, PalmAngles, Openness, Gestures, Pose,
+    Count
+};
+constexpr size_t OSC_FIELD_COUNT = static_cast<size_t>(OscField::Count);
+
+// Bit per OscField; set = the field's channels are sent.
+using OscFieldMask = uint32_t;
+constexpr OscFieldMask oscFieldBit(OscField field) { return OscFieldMask(1) << static_cast<unsigned>(field); }
+static_assert(OSC_FIELD_COUNT <= 32, "OscFieldMask has one bit per field");
+
+// Fields read from the biomechanics in DerivedHandData (computeHandFeatures)
+constexpr OscFieldMask HAND_FEATURE_FIELDS =
+    oscFieldBit(OscField::FingerFlexion) | oscFieldBit(OscField::FingerCurl) | oscFieldBit(OscField::FingerSpread) |
+    oscFieldBit(OscField::PalmAngles) | oscFieldBit(OscField::Openness);
+
+struct OscFieldInfo {
+    OscField field;
+    const char* configKey; // Key under "booleanSettings" in config.json
+    const char* label;     // Checkbox label in the UI
+    bool enabledByDefault;
+};
+
+// All fields, indexed by OscField; also the order the UI lists them in.
+const std::array<OscFieldInfo, OSC_FIELD_COUNT>& oscFields();
+OscFieldMask defaultOscFieldMask();
+
+// How a channel's value is read from HandData.
+enum class OscValueKind : uint8_t {
+    Float,        // float at sourceOffset
+    Flag,         // bool at sourceOffset, sent as 0 or 1
+    Microseconds, // uint64_t at sourceOffset, sent in seconds
+    ZeroOnly      // No live value; only sent (as 0) when the hand is lost
+};
+
+// Struct a channel's sourceOffset points into.
+enum class OscSource : uint8_t {
+    Hand,   // HandData, as reported by the tracker
+    Derived // DerivedHandData, computed by DataProcessor
+};
+
+// Which form of the point positions is sent: millimetres (palm/tx, ...),
+// normalized to the device's interaction box (palm/norm/x, ...) or both.
+enum class PositionOutput : uint8_t { Raw, Normalized, Both };
+const char* positionOutputToString(PositionOutput output);
+PositionOutput positionOutputFromString(const std::string& value); // Unknown -> Raw
+
+// Position form a channel belongs to; Any channels don't depend on PositionOutput.
+enum class OscSpace : uint8_t { Any, Raw, Normalized };
+
+// Validity conditions a channel can depend on, as bit indices into handValidity().
+constexpr uint8_t OSC_GUARD_NONE = 0xFF;
+constexpr uint8_t OSC_GUARD_ARM = 0;
+constexpr uint8_t OSC_GUARD_FINGER = 1; // + finger index (thumb first): finger and its distal bone valid
+
+struct OscChannel {
+    OscField field;
+    std::string address;   // Relative to /leap/<alias>/<left|right>/
+    uint32_t sourceOffset; // Byte offset into HandData
+    OscValueKind kind;
+    uint8_t guard;         // OSC_GUARD_*; the value is skipped while the condition fails
+    bool zeroOnLoss;       // Sent as 0 when the hand disappears
+    OscSource source = OscSource::Hand;
+    OscField pointField = OscField::Count; // If set, also needs this field enabled
+    OscSpace space = OscSpace::Any;
+};
+
+// Every channel. A channel's index here is its address id.
+const std::vector<OscChannel>& oscChannels();
+
+// One bit per OSC_GUARD_* condition that holds for hand.
+uint32_t handValidity(const HandData& hand);
+
+// Flat list of what to send for the enabled fields, built when they change so
+// the per-hand work is a gather loop without per-field branches.
+struct OscEmission {
+    uint32_t sourceOffset;
+    uint16_t addressId;
+    OscValueKind kind;
+    uint8_t guard;
+    OscSource source;
+};
+
+struct OscEmissionPlan {
+    std::vector<OscEmission> live;    // Sent for every present hand, in order
+    std::vector<uint16_t> zeroOnLoss; // Address ids sent as 0 when a hand is lost
+};
+
+OscEmissionPlan compileEmissionPlan(OscFieldMask fields, PositionOutput positions = PositionOutput::Raw);
+
+inline float readChannelValue(const HandData& hand, const DerivedHandData& derived, const OscEmission& emission) {
+    const void* base = emission.source == OscSource::Derived ? static_cast<const void*>(&derived) : static_cast<const void*>(&hand);
+    const unsigned char* source = static_cast<const unsigned char*>(base) + emission.sourceOffset;
+    switch (emission.kind) {
+        case OscValueKind::Float:        return *reinterpret_cast<const float*>(source);
+        case OscValueKind::Flag:         return *reinterpret_cast<const bool*>(source) ? 1.f : 0.f;
+        case OscValueKind::Microseconds: return static_cast<float>(*reinterpret_cast<const uint64_t*>(source)) / 1'000'000.0f;
+        case OscValueKind::ZeroOnly:     break;
+    }
+    return 0.f;
+}
@@ -0,0 +1,81 @@
+#include "PointerGain.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Longest frame gap that still counts as movement; after a longer stall the
+// accumulated distance would land as one jump.
+constexpr float MAX_DT = 0.25f;
+
+float clamp01(float value) { return (std::min)(1.0f, (std::max)(0.0f, value)); }
+}
+
+const char* gainVelocitySourceToString(GainVelocitySource source) {
+    return source == GainVelocitySource::Points ? "points" : "palm";
+}
+
+GainVelocitySource gainVelocitySourceFromString(const std::string& value) {
+    return value == "points" ? GainVelocitySource::Points : GainVelocitySource::Palm;
+}
+
+float GainCurve::gainAt(float speed) const {
+    const float toMid = clamp01((speed - lowSpeed) / (std::max)(midSpeed - lowSpeed, 1e-3f));
+    const float toMax = clamp01((speed - midSpeed) / (std::max)(midSpeed, 1e-3f));
+    return baseGain + (midGain - baseGain) * toMid + (maxGain - midGain) * toMax;
+}
+
+std::array<PointerGain::Lanes, 3> PointerGain::centre() {
+    std::array<Lanes, 3> lanes;
+    for (Lanes& axisLanes : lanes) axisLanes.fill(0.5f);
+    return lanes;
+}
+
+void PointerGain::reset() {
+    hasPrevious_.fill(0.0f);
+    lastTimestampUs_ = 0;
+}
+
+void PointerGain::apply(const HandData& hand, const HandPointPositions& points, uint64_t timestampUs,
+                        const GainCurve& curve, const Vector3& rangeMm, DerivedHandData& out) {
+    const auto& position = points.position;
+    const Lanes& valid = points.valid;
+    const bool newer = lastTimestampUs_ != 0 && timestampUs > lastTimestampUs_ &&
+                       static_cast<float>(timestampUs - lastTimestampUs_) * 1e-6f <= MAX_DT;
+    const float dt = newer ? static_cast<float>(timestampUs - lastTimestampUs_) * 1e-6f : 1.0f;
+    lastTimestampUs_ = timestampUs;
+
+    // One pass over all lanes: movement, speed, gain, cursor. Plain loops over
+    // fixed-size arrays, which the compiler vectorizes.
+    Lanes moves{};
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        moves[lane] = newer ? valid[lane] * hasPrevious_[lane] : 0.0f;
+    }
+    std::array<Lanes, 3> delta{};
+    Lanes speedSquared{};
+    for (size_t a = 0; a < 3; ++a) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            delta[a][lane] = (position[a][lane] - previous_[a][lane]) * moves[lane];
+            speedSquared[lane] += delta[a][lane] * delta[a][lane];
+        }
+    }
+    Lanes gain{};
+    if (curve.velocitySource == GainVelocitySource::Palm) {
+        const Vector3& v = hand.palm.velocity;
+        gain.fill(curve.gainAt(std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z)));
+    } else {
+        for (size_t lane = 0; lane < LANES; ++lane) gain[lane] = curve.gainAt(std::sqrt(speedSquared[lane]) / dt);
+    }
+    for (size_t a = 0; a < 3; ++a) {
+        const float scale = 1.0f / (std::max)(*vectorAxis(rangeMm, a), 1e-3f);
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            cursor_[a][lane] = clamp01(cursor_[a][lane] + delta[a][lane] * gain[lane] * scale);
+        }
+    }
+    // A point that was invalid this frame starts over once it is valid again
+    previous_ = position;
+    hasPrevious_ = valid;
+
+    for (size_t p = 0; p < HAND_POINT_COUNT; ++p) {
+        for (size_t a = 0; a < 3; ++a) *vectorAxis(out.cursor[p], a) = cursor_[a][p];
+    }
+}
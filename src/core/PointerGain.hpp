@@ -0,0 +1,65 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "HandData.hpp"
+#include "DerivedHandData.hpp"
+
+// Pointer-acceleration gain: each point's movement since the last frame is
+// scaled by a gain that grows with hand speed and added to a relative cursor.
+// Slow movement gives fine control, fast movement covers the range quickly,
+// like mouse acceleration. Cursors live in 0-1 per axis and stay where they
+// are while the hand is away.
+//
+// The gain curve is piecewise linear in speed (mm/s):
+//   speed <= lowSpeed            baseGain
+//   lowSpeed .. midSpeed         baseGain -> midGain
+//   midSpeed .. 2 * midSpeed     midGain -> maxGain
+//   above                        maxGain
+
+// Speed the gain is looked up with.
+enum class GainVelocitySource : uint8_t {
+    Palm,  // The tracker's palm velocity, for every point (one gain per hand)
+    Points // Each point's own speed, differentiated from its positions
+};
+const char* gainVelocitySourceToString(GainVelocitySource source);
+GainVelocitySource gainVelocitySourceFromString(const std::string& value); // Unknown -> Palm
+
+struct GainCurve {
+    float baseGain = 1.0f;
+    float midGain = 3.0f;
+    float maxGain = 6.0f;
+    float lowSpeed = 80.0f;  // mm/s
+    float midSpeed = 240.0f; // mm/s
+    GainVelocitySource velocitySource = GainVelocitySource::Palm;
+
+    float gainAt(float speed) const;
+};
+
+class PointerGain {
+public:
+    PointerGain() { cursor_ = centre(); }
+
+    // Forgets the previous positions, so the next frame moves nothing. The
+    // cursors are kept.
+    void reset();
+
+    // Moves every cursor by its point's movement since the previous frame,
+    // times the gain, with rangeMm mapping millimetres to the 0-1 cursor range,
+    // and writes the cursors to out. points are hand's gathered HandPoints;
+    // invalid ones don't move. A frame that is not newer than the previous one
+    // moves nothing.
+    void apply(const HandData& hand, const HandPointPositions& points, uint64_t timestampUs,
+               const GainCurve& curve, const Vector3& rangeMm, DerivedHandData& out);
+
+private:
+    using Lanes = HandPointLanes;
+    static constexpr size_t LANES = HAND_POINT_LANES;
+    static std::array<Lanes, 3> centre();
+
+    std::array<Lanes, 3> previous_{}; // [axis][lane], last frame's positions
+    std::array<Lanes, 3> cursor_{};
+    Lanes hasPrevious_{};             // 1 where previous_ was a valid position
+    uint64_t lastTimestampUs_ = 0;
+};
@@ -0,0 +1,111 @@
+#include "PoseClassifier.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define POSE_CLASSIFIER_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define POSE_CLASSIFIER_SSE 1
+#endif
+
+namespace {
+float distance(const Vector3& a, const Vector3& b) {
+    const float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// Sum of squared differences over all POSE_FEATURE_COUNT values
+float squaredDistance(const PoseFeatures& a, const PoseFeatures& b) {
+    const float* pa = a.values.data();
+    const float* pb = b.values.data();
+#if defined(POSE_CLASSIFIER_AVX)
+    __m256 sum = _mm256_setzero_ps();
+    for (size_t i = 0; i < POSE_FEATURE_COUNT; i += 8) {
+        const __m256 d = _mm256_sub_ps(_mm256_load_ps(pa + i), _mm256_load_ps(pb + i));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(d, d));
+    }
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    half = _mm_add_ss(half, _mm_shuffle_ps(half, half, 1));
+    return _mm_cvtss_f32(half);
+#elif defined(POSE_CLASSIFIER_SSE)
+    __m128 sum = _mm_setzero_ps();
+    for (size_t i = 0; i < POSE_FEATURE_COUNT; i += 4) {
+        const __m128 d = _mm_sub_ps(_mm_load_ps(pa + i), _mm_load_ps(pb + i));
+        sum = _mm_add_ps(sum, _mm_mul_ps(d, d));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+#else
+    float sum = 0.0f;
+    for (size_t i = 0; i < POSE_FEATURE_COUNT; ++i) {
+        const float d = pa[i] - pb[i];
+        sum += d * d;
+    }
+    return sum;
+#endif
+}
+}
+
+void buildPoseFeatures(const HandData& hand, const DerivedHandData& features, PoseFeatures& out) {
+    float length = 0.0f;
+    for (const BoneData& bone : hand.fingers[2].bones) length += distance(bone.prevJoint, bone.nextJoint);
+    const float inverseLength = length > 1e-3f ? 1.0f / length : 0.0f;
+
+    float* v = out.values.data();
+    for (size_t f = 0; f < 5; ++f) {
+        for (size_t j = 0; j < 3; ++j) *v++ = features.flexion[f][j] / 180.0f;
+    }
+    for (float spread : features.spread) *v++ = spread / 90.0f;
+    for (const FingerData& finger : hand.fingers) {
+        *v++ = distance(finger.bones[3].nextJoint, hand.palm.position) * inverseLength;
+    }
+    const Vector3& thumbTip = hand.fingers[0].bones[3].nextJoint;
+    for (size_t f = 1; f < 5; ++f) {
+        *v++ = distance(thumbTip, hand.fingers[f].bones[3].nextJoint) * inverseLength;
+    }
+    std::fill(v, out.values.data() + POSE_FEATURE_COUNT, 0.0f);
+}
+
+PoseLibrary::PoseLibrary(const std::vector<PoseTemplate>& poses) {
+    for (const PoseTemplate& pose : poses) {
+        if (pose.id == 0) continue;
+        for (const PoseFeatures& sample : pose.samples) {
+            samples_.push_back(sample);
+            sampleIds_.push_back(pose.id);
+        }
+    }
+}
+
+PoseMatch PoseLibrary::classify(const PoseFeatures& features, const PoseMatchConfig& config) const {
+    // Nearest sample, and nearest sample of a different pose
+    float best = std::numeric_limits<float>::max();
+    float runnerUp = std::numeric_limits<float>::max();
+    int bestId = 0;
+    for (size_t i = 0; i < samples_.size(); ++i) {
+        const float d = squaredDistance(features, samples_[i]);
+        if (d < best) {
+            if (sampleIds_[i] != bestId) runnerUp = best;
+            best = d;
+            bestId = sampleIds_[i];
+        } else if (d < runnerUp && sampleIds_[i] != bestId) {
+            runnerUp = d;
+        }
+    }
+
+    PoseMatch match;
+    if (bestId == 0) return match;
+    const float bestRms = std::sqrt(best / POSE_FEATURES_USED);
+    if (bestRms > config.maxDistance) return match;
+    if (runnerUp != std::numeric_limits<float>::max()) {
+        const float runnerUpRms = std::sqrt(runnerUp / POSE_FEATURES_USED);
+        if (runnerUpRms <= 0.0f || 1.0f - bestRms / runnerUpRms < config.minMargin) return match;
+    }
+    match.id = bestId;
+    match.score = config.maxDistance > 0.0f ? 1.0f - bestRms / config.maxDistance : 1.0f;
+    return match;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "HandData.hpp"
+#include "DerivedHandData.hpp"
+
+// Static hand shapes (point, fist, open, ...) matched against recorded
+// templates by nearest neighbour.
+//
+// A hand is described by a feature vector that doesn't depend on where the
+// hand is or how big it is:
+//   0-14   flexion of each finger's MCP, PIP, DIP (thumb first), / 180 degrees
+//   15-18  spread between adjacent fingers, / 90 degrees
+//   19-23  fingertip to palm distance per finger, / hand length
+//   24-27  thumb tip to index/middle/ring/pinky tip distance, / hand length
+// Hand length is the length of the middle finger's four bones. The vector is
+// padded with zeros to whole SIMD vectors.
+
+constexpr size_t POSE_FEATURES_USED = 28;
+constexpr size_t POSE_FEATURE_COUNT = 32;
+
+struct alignas(32) PoseFeatures {
+    std::array<float, POSE_FEATURE_COUNT> values{};
+};
+
+// Needs features' flexion and spread from computeHandFeatures(hand, ...).
+void buildPoseFeatures(const HandData& hand, const DerivedHandData& features, PoseFeatures& out);
+
+// One pose and the samples recorded for it ("poses" in config.json).
+struct PoseTemplate {
+    int id = 0; // Sent as pose/id; 0 is reserved for "no pose"
+    std::string name;
+    std::vector<PoseFeatures> samples;
+};
+
+struct PoseMatchConfig {
+    float maxDistance = 0.15f; // RMS feature distance beyond which nothing matches
+    float minMargin = 0.2f;    // The runner-up pose must be this fraction farther away
+};
+
+struct PoseMatch {
+    int id = 0;         // 0 = no pose matched
+    float score = 0.0f; // 1 on a template, falling to 0 at maxDistance
+};
+
+// Samples of every pose in one flat, aligned array, searched exhaustively
+// with the compiled-in SIMD width (as HandSmoother). Immutable once built, so
+// a ProcessingConfig version can share it with every frame.
+class PoseLibrary {
+public:
+    PoseLibrary() = default;
+    explicit PoseLibrary(const std::vector<PoseTemplate>& poses);
+
+    bool empty() const { return samples_.empty(); }
+    size_t sampleCount() const { return samples_.size(); }
+
+    // Nearest sample's pose, if it is within config.maxDistance and the
+    // nearest sample of any other pose is far enough behind.
+    PoseMatch classify(const PoseFeatures& features, const PoseMatchConfig& config) const;
+
+private:
+    std::vector<PoseFeatures> samples_;
+    std::vector<int> sampleIds_; // Pose id per sample
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include "OscFieldRegistry.hpp"
+#include "InteractionBox.hpp"
+#include "HandSmoother.hpp"
+#include "HandPredictor.hpp"
+#include "PointerGain.hpp"
+#include "GestureDetector.hpp"
+#include "PoseClassifier.hpp"
+
+// Everything DataProcessor reads per frame that the UI can change. One
+// instance is an immutable version: changes are made on a copy and published
+// through AtomicSnapshot, and the frame-processing thread loads the current
+// version once per frame. A frame therefore never sees half of an update.
+struct ProcessingConfig {
+    uint64_t version = 0; // Incremented on every published change
+
+    // OSC output fields and position form, and the plan compiled from them
+    OscFieldMask fields = defaultOscFieldMask();
+    PositionOutput positionOutput = PositionOutput::Raw;
+    OscEmissionPlan plan = compileEmissionPlan(fields, positionOutput);
+
+    // Interaction boxes by device serial, for normalized positions and cursor
+    // scaling. Devices without one use the default box, or learn theirs.
+    std::map<std::string, InteractionBox> interactionBoxes;
+    bool learnInteractionBoxes = false;
+
+    // Skeleton blobs (OscField::Skeleton) use int16 instead of float32
+    bool skeletonQuantized = false;
+
+    // Hand-loss hysteresis: a hand must be missing for more than lossHoldFrames
+    // consecutive frames, or for lossHoldMs by frame timestamp, whichever comes
+    // first, before it is zeroed. 0 disables a limit; both 0 zeroes at once.
+    uint32_t lossHoldFrames = 0;
+    uint32_t lossHoldMs = 0;
+
+    // Times each zero bundle is sent on hand or device loss (for lossy links)
+    uint32_t zeroBundleRepeats = 1;
+
+    // One Euro filter parameters per point group; all disabled by default
+    SmoothingConfig smoothing;
+
+    // Latency-compensating extrapolation, applied after smoothing; off by default
+    PredictionConfig prediction;
+
+    // Speed-dependent gain for the relative cursors (OscField::Cursor)
+    GainCurve gainCurve;
+
+    // Thresholds of the gesture events (OscField::Gestures)
+    GestureConfig gestures;
+
+    // Pose templates (OscField::Pose) and their match thresholds. The library
+    // is shared between versions, so a new version only copies the pointer.
+    std::shared_ptr<const PoseLibrary> poses = std::make_shared<const PoseLibrary>();
+    PoseMatchConfig poseMatch;
+};
@@ -0,0 +1,137 @@
+#include "SkeletonPacket.hpp"
+#include "OscFieldRegistry.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+constexpr float POSITION_STEP_MM = 0.1f;
+constexpr float ROTATION_SCALE = 32767.0f;
+
+// The positions and rotations in packet order, so encode and decode walk
+// the same lists.
+template<typename Hand, typename Fn>
+void forEachPosition(Hand& hand, Fn&& fn) {
+    fn(hand.palm.position);
+    fn(hand.arm.wristPosition);
+    fn(hand.arm.elbowPosition);
+    for (auto& finger : hand.fingers) {
+        fn(finger.bones[0].prevJoint);
+        for (auto& bone : finger.bones) fn(bone.nextJoint);
+    }
+}
+
+template<typename Hand, typename Fn>
+void forEachRotation(Hand& hand, Fn&& fn) {
+    fn(hand.palm.orientation);
+    fn(hand.arm.rotation);
+    for (auto& finger : hand.fingers) {
+        for (auto& bone : finger.bones) fn(bone.rotation);
+    }
+}
+
+class Writer {
+public:
+    Writer(uint8_t* data, bool quantized) : p_(data), quantized_(quantized) {}
+    void u8(uint8_t v) { *p_++ = v; }
+    void value(float v, float scale) {
+        if (quantized_) {
+            const float q = (std::max)(-32767.0f, (std::min)(32767.0f, std::round(v * scale)));
+            const uint16_t bits = static_cast<uint16_t>(static_cast<int16_t>(q));
+            *p_++ = static_cast<uint8_t>(bits);
+            *p_++ = static_cast<uint8_t>(bits >> 8);
+        } else {
+            uint32_t bits;
+            std::memcpy(&bits, &v, sizeof bits);
+            for (int i = 0; i < 4; ++i) *p_++ = static_cast<uint8_t>(bits >> (8 * i));
+        }
+    }
+private:
+    uint8_t* p_;
+    bool quantized_;
+};
+
+class Reader {
+public:
+    Reader(const uint8_t* data, bool quantized) : p_(data), quantized_(quantized) {}
+    float value(float scale) {
+        if (quantized_) {
+            const uint16_t bits = static_cast<uint16_t>(p_[0] | (p_[1] << 8));
+            p_ += 2;
+            return static_cast<float>(static_cast<int16_t>(bits)) / scale;
+        }
+        uint32_t bits = 0;
+        for (int i = 0; i < 4; ++i) bits |= static_cast<uint32_t>(p_[i]) << (8 * i);
+        p_ += 4;
+        float v;
+        std::memcpy(&v, &bits, sizeof v);
+        return v;
+    }
+private:
+    const uint8_t* p_;
+    bool quantized_;
+};
+}
+
+void encodeSkeleton(const HandData& hand, bool quantized, std::vector<uint8_t>& out) {
+    out.resize(skeletonPacketSize(quantized));
+    Writer w(out.data(), quantized);
+    uint8_t validity = 0;
+    const uint32_t guards = handValidity(hand);
+    if (guards & (1u << OSC_GUARD_ARM)) validity |= 1u;
+    for (size_t f = 0; f < 5; ++f) {
+        if (guards & (1u << (OSC_GUARD_FINGER + f))) validity |= static_cast<uint8_t>(1u << (1 + f));
+    }
+    w.u8(SKELETON_VERSION);
+    w.u8(quantized ? SKELETON_FLAG_QUANTIZED : 0);
+    w.u8(static_cast<uint8_t>(hand.handType));
+    w.u8(validity);
+
+    const float positionScale = quantized ? 1.0f / POSITION_STEP_MM : 1.0f;
+    const float rotationScale = quantized ? ROTATION_SCALE : 1.0f;
+    forEachPosition(hand, [&](const Vector3& v) {
+        w.value(v.x, positionScale);
+        w.value(v.y, positionScale);
+        w.value(v.z, positionScale);
+    });
+    forEachRotation(hand, [&](const Quaternion& q) {
+        w.value(q.w, rotationScale);
+        w.value(q.x, rotationScale);
+        w.value(q.y, rotationScale);
+        w.value(q.z, rotationScale);
+    });
+}
+
+bool decodeSkeleton(const uint8_t* data, size_t size, HandData& hand) {
+    if (size < SKELETON_HEADER_SIZE || data[0] != SKELETON_VERSION || data[2] > 1) return false;
+    const bool quantized = (data[1] & SKELETON_FLAG_QUANTIZED) != 0;
+    if (size != skeletonPacketSize(quantized)) return false;
+
+    hand.handType = static_cast<HandType>(data[2]);
+    hand.arm.setValid((data[3] & 1u) != 0);
+    for (size_t f = 0; f < 5; ++f) {
+        const bool valid = (data[3] & (1u << (1 + f))) != 0;
+        hand.fingers[f].setValid(valid);
+        hand.fingers[f].bones[3].setValid(valid);
+    }
+
+    Reader r(data + SKELETON_HEADER_SIZE, quantized);
+    const float positionScale = quantized ? 1.0f / POSITION_STEP_MM : 1.0f;
+    const float rotationScale = quantized ? ROTATION_SCALE : 1.0f;
+    forEachPosition(hand, [&](Vector3& v) {
+        v.x = r.value(positionScale);
+        v.y = r.value(positionScale);
+        v.z = r.value(positionScale);
+    });
+    forEachRotation(hand, [&](Quaternion& q) {
+        q.w = r.value(rotationScale);
+        q.x = r.value(rotationScale);
+        q.y = r.value(rotationScale);
+        q.z = r.value(rotationScale);
+    });
+    // Bones are chained: each starts where the previous one ends
+    for (FingerData& finger : hand.fingers) {
+        for (size_t b = 1; b < finger.bones.size(); ++b) finger.bones[b].prevJoint = finger.bones[b - 1].nextJoint;
+    }
+    return true;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "HandData.hpp"
+
+// One hand's full skeleton as a single OSC blob (/leap/<alias>/<hand>/skeleton),
+// instead of a few hundred scalar messages. Little-endian:
+//
+//   u8  version (SKELETON_VERSION)
+//   u8  flags: bit 0 = quantized
+//   u8  hand type (0 = left, 1 = right)
+//   u8  validity: bit 0 = arm, bits 1-5 = thumb..pinky (finger and distal bone)
+//   28 positions, x y z:  palm, wrist, elbow, then per finger thumb..pinky the
+//                         metacarpal base and the next joint of its 4 bones
+//   22 rotations, w x y z: palm, arm, then per finger its 4 bones
+//
+// Full precision uses float32 (692 bytes). Quantized uses int16: positions in
+// 0.1 mm (+-3276.7 mm), rotation components times 32767 (348 bytes), so both
+// hands fit in one datagram with room to spare.
+constexpr uint8_t SKELETON_VERSION = 1;
+constexpr uint8_t SKELETON_FLAG_QUANTIZED = 1;
+constexpr size_t SKELETON_HEADER_SIZE = 4;
+constexpr size_t SKELETON_POSITIONS = 3 + 5 * 5;
+constexpr size_t SKELETON_ROTATIONS = 2 + 5 * 4;
+
+constexpr size_t skeletonPacketSize(bool quantized) {
+    return SKELETON_HEADER_SIZE + (quantized ? 2 : 4) * (SKELETON_POSITIONS * 3 + SKELETON_ROTATIONS * 4);
+}
+
+// Replaces out's contents; no allocation once out has held a packet.
+void encodeSkeleton(const HandData& hand, bool quantized, std::vector<uint8_t>& out);
+
+// Fills the skeleton fields of hand (positions, rotations, hand type,
+// validity) from a packet. Returns false for a malformed packet.
+bool decodeSkeleton(const uint8_t* data, size_t size, HandData& hand);
@@ -2,6 +2,17 @@
 
 #include <string>
 #include <map>
+#include "utils/ThreadPlacement.h"
+#include "core/FrameOverflowPolicy.hpp"
+#include "core/OscFieldRegistry.hpp"
+#include "core/HandSmoother.hpp"
+#include "core/HandPredictor.hpp"
+#include "core/PointerGain.hpp"
+#include "core/InteractionBox.hpp"
+#include "core/GestureDetector.hpp"
+#include "core/PoseClassifier.hpp"
+#include "core/HandFusion.hpp"
+#include "core/FixedRateClock.hpp"
 
 // Abstract interface for config file read/write
 class DeviceAliasManager;
@@ -25,6 +36,66 @@ public:
     virtual bool getLowLatencyMode() const = 0;
     virtual void setLowLatencyMode(bool enabled) = 0;
 
+    // Thread placement (core pinning / scheduling), keyed by ThreadNames::*
+    virtual ThreadPlacement getThreadPlacement(const std::string& threadName) const = 0;
+    virtual void setThreadPlacement(const std::string& threadName, const ThreadPlacement& placement) = 0;
+
+    // Frame queue between the poll thread and the main loop
+    virtual FrameOverflowPolicy getFrameQueueOverflowPolicy() const = 0;
+    virtual void setFrameQueueOverflowPolicy(FrameOverflowPolicy policy) = 0;
+    // Period of the /leap/stats OSC messages and UI queue counters; 0 disables the OSC messages
+    virtual int getQueueStatsIntervalMs() const = 0;
+    virtual void setQueueStatsIntervalMs(int intervalMs) = 0;
+    // Backlog (frames) above which the main loop skips stale frames; 0 processes everything
+    virtual int getCatchUpThreshold() const = 0;
+    virtual void setCatchUpThreshold(int frames) = 0;
+    // Worker threads that run the sorter/processor stages, sharded by device; 0 runs them on the main loop
+    virtual int getProcessingWorkers() const = 0;
+    virtual void setProcessingWorkers(int workers) = 0;
+    // Hand-loss hysteresis: frames / milliseconds a hand may be missing before it is zeroed; 0 disables each
+    virtual int getHandLossHoldFrames() const = 0;
+    virtual void setHandLossHoldFrames(int frames) = 0;
+    virtual int getHandLossHoldMs() const = 0;
+    virtual void setHandLossHoldMs(int milliseconds) = 0;
+    // Times each zero bundle is sent when a hand or device is lost (1-10)
+    virtual int getZeroBundleRepeats() const = 0;
+    virtual void setZeroBundleRepeats(int repeats) = 0;
+    // One Euro position smoothing per point group (palm, wrist, fingers)
+    virtual SmoothingConfig getSmoothing() const = 0;
+    virtual void setSmoothing(const SmoothingConfig& smoothing) = 0;
+    // Latency-compensating extrapolation of positions
+    virtual PredictionConfig getPrediction() const = 0;
+    virtual void setPrediction(const PredictionConfig& prediction) = 0;
+    // Leap input: event-driven, or interpolated at a fixed rate
+    virtual InputConfig getInput() const = 0;
+    virtual void setInput(const InputConfig& input) = 0;
+    // Speed-dependent gain of the relative cursors
+    virtual GainCurve getGainCurve() const = 0;
+    virtual void setGainCurve(const GainCurve& curve) = 0;
+    // Raw millimetres, interaction-box normalized positions, or both
+    virtual PositionOutput getPositionOutput() const = 0;
+    virtual void setPositionOutput(PositionOutput output) = 0;
+    // Interaction boxes by device serial; devices without one use the default box or learn theirs
+    virtual std::map<std::string, InteractionBox> getInteractionBoxes() const = 0;
+    virtual void setInteractionBox(const std::string& serialNumber, const InteractionBox& box) = 0;
+    virtual bool getLearnInteractionBoxes() const = 0;
+    virtual void setLearnInteractionBoxes(bool learn) = 0;
+    // Skeleton blobs as int16 (about half the size) instead of float32
+    virtual bool getSkeletonQuantized() const = 0;
+    virtual void setSkeletonQuantized(bool quantized) = 0;
+    // Thresholds of the gesture events (pinch/grab hysteresis, swipe and tap speeds)
+    virtual GestureConfig getGestures() const = 0;
+    virtual void setGestures(const GestureConfig& gestures) = 0;
+    // Pose templates (recorded from the UI) and the thresholds they are matched with
+    virtual std::vector<PoseTemplate> getPoses() const = 0;
+    virtual void setPoses(const std::vector<PoseTemplate>& poses) = 0;
+    virtual PoseMatchConfig getPoseMatch() const = 0;
+    virtual void setPoseMatch(const PoseMatchConfig& match) = 0;
+    // Multi-device fusion, with each device's extrinsics (its pose in room space)
+    virtual FusionConfig getFusion() const = 0;
+    virtual void setFusion(const FusionConfig& fusion) = 0;
+    virtual void setDeviceExtrinsic(const std::string& serialNumber, const RigidTransform& transform) = 0;
+
     // Hand Assignments
     virtual std::string getDefaultHandAssignment(const std::string& serialNumber) const = 0;
     virtual void setDefaultHandAssignment(const std::string& serialNumber, const std::string& handType) = 0;
@@ -35,35 +106,7 @@ public:
     virtual DeviceAliasManager& getDeviceAliasManager() = 0;
     virtual const DeviceAliasManager& getDeviceAliasManager() const = 0;
 
-    // Feature flags (getters)
-    virtual bool isSendPalmEnabled() const = 0;
-    virtual bool isSendWristEnabled() const = 0;
-    virtual bool isSendThumbEnabled() const = 0;
-    virtual bool isSendIndexEnabled() const = 0;
-    virtual bool isSendMiddleEnabled() const = 0;
-    virtual bool isSendRingEnabled() const = 0;
-    virtual bool isSendPinkyEnabled() const = 0;
-    virtual bool isSendPalmOrientationEnabled() const = 0;
-    virtual bool isSendPalmVelocityEnabled() const = 0;
-    virtual bool isSendPalmNormalEnabled() const = 0;
-    virtual bool isSendVisibleTimeEnabled() const = 0;
-    virtual bool isSendFingerIsExtendedEnabled() const = 0;
-    virtual bool isSendPinchStrengthEnabled() const = 0;
-    virtual bool isSendGrabStrengthEnabled() const = 0;
-
-    // Feature flags (setters)
-    virtual void setSendPalmEnabled(bool enabled) = 0;
-    virtual void setSendWristEnabled(bool enabled) = 0;
-    virtual void setSendThumbEnabled(bool enabled) = 0;
-    virtual void setSendIndexEnabled(bool enabled) = 0;
-    virtual void setSendMiddleEnabled(bool enabled) = 0;
-    virtual void setSendRingEnabled(bool enabled) = 0;
-    virtual void setSendPinkyEnabled(bool enabled) = 0;
-    virtual void setSendPalmOrientationEnabled(bool enabled) = 0;
-    virtual void setSendPalmVelocityEnabled(bool enabled) = 0;
-    virtual void setSendPalmNormalEnabled(bool enabled) = 0;
-    virtual void setSendVisibleTimeEnabled(bool enabled) = 0;
-    virtual void setSendFingerIsExtendedEnabled(bool enabled) = 0;
-    virtual void setSendPinchStrengthEnabled(bool enabled) = 0;
-    virtual void setSendGrabStrengthEnabled(bool enabled) = 0;
+    // OSC output fields (see OscFieldRegistry.hpp); stored under "booleanSettings"
+    virtual OscFieldMask getOscFieldMask() const = 0;
+    virtual void setOscFieldMask(OscFieldMask fields) = 0;
 };
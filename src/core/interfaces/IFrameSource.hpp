@@ -1,11 +1,15 @@
 #pragma once
 
 #include "core/FrameData.hpp"
+#include <string>
 
 // Supplies a stream of FrameData
 class IFrameSource {
 public:
     virtual ~IFrameSource() = default;
+    // Most recent frame of any device; false if none has arrived yet
     virtual bool getNextFrame(FrameData& outFrame) = 0;
+    // Most recent frame of one device; false if that device has sent none
+    virtual bool getLatestFrame(const std::string& deviceId, FrameData& outFrame) = 0;
     // Add more as needed for frame streaming
 };
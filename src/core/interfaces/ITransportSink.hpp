@@ -11,6 +11,10 @@ public:
     virtual ~ITransportSink() = default;
     virtual bool send(const void* data, size_t size) = 0;
     virtual void sendOscMessage(const OscMessage& message) = 0;
+    // Sinks that can't group messages send them one by one
+    virtual void sendOscBundle(const OscBundle& bundle) {
+        for (const OscMessage& message : bundle.messages) sendOscMessage(message);
+    }
     virtual void updateTarget(const std::string& target, int port) = 0;
     virtual void close() = 0;
     // Add more as needed for transport
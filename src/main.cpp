@@ -190,8 +190,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
         //     softZone = 0.10f;
         //     concreteConfig->setSoftZoneWidth(softZone);
         // }
-        // Removed gain and soft zone settings
-        // dataProcessor->setGainParams(baseGain, midGain, maxGain, lowSpeedThresh, midSpeedThresh);
+        // Gain curve reaches DataProcessor via AppCore::applyProcessingSettings() on start
+        // Removed soft zone settings
         // dataProcessor->setSoftZone(softZone);
         logger->log("DataProcessor initialized from config."); // Updated log message
 
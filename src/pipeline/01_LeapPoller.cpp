@@ -12,18 +12,22 @@
 #include "../core/HandData.hpp" // Include HandData for conversion
 
 namespace { // Put in anonymous namespace
-FrameData convertLeapToFrameData(const LEAP_TRACKING_EVENT* tracking, const std::string& deviceSerial) {
-    FrameData frame;
-    if (!tracking) return frame;
-
-    frame.deviceId = deviceSerial; // Assign deviceId
+// Converts into an existing FrameData so its storage is reused frame to frame:
+// hands are fixed-layout and the hands vector only grows, never reallocates
+// once it has seen the maximum hand count.
+void convertLeapToFrameData(const LEAP_TRACKING_EVENT* tracking, const std::string& deviceSerial, FrameData& frame) {
+    frame.hands.clear();
+    if (!tracking) return;
+
+    frame.deviceId = deviceSerial; // Assign deviceId (same serial every frame, so no reallocation)
     frame.timestamp = tracking->info.timestamp;
 
+    frame.hands.resize(tracking->nHands);
     for (uint32_t i = 0; i < tracking->nHands; ++i) {
         const LEAP_HAND& srcHand = tracking->pHands[i];
-        HandData hand;
-        hand.handType = srcHand.type == eLeapHandType_Left ? "left" : "right";
-        // ... (copy palm, arm, fingers, etc. - same as before) ...
+        HandData& hand = frame.hands[i];
+        hand.handType = srcHand.type == eLeapHandType_Left ? HandType::Left : HandType::Right;
+        hand.id = srcHand.id;
         hand.palm.position = { srcHand.palm.position.x, srcHand.palm.position.y, srcHand.palm.position.z };
         hand.palm.velocity = { srcHand.palm.velocity.x, srcHand.palm.velocity.y, srcHand.palm.velocity.z };
         hand.palm.normal = { srcHand.palm.normal.x, srcHand.palm.normal.y, srcHand.palm.normal.z };
@@ -38,32 +42,36 @@ FrameData convertLeapToFrameData(const LEAP_TRACKING_EVENT* tracking, const std:
         // Fingers
         for (int f = 0; f < 5; ++f) {
             const LEAP_DIGIT& srcFinger = srcHand.digits[f];
-            FingerData finger;
+            FingerData& finger = hand.fingers[f];
             finger.fingerId = srcFinger.finger_id;
             finger.isExtended = srcFinger.is_extended != 0;
             for (int b = 0; b < 4; ++b) {
                 const LEAP_BONE& srcBone = srcFinger.bones[b];
-                BoneData bone;
+                BoneData& bone = finger.bones[b];
                 bone.prevJoint = { srcBone.prev_joint.x, srcBone.prev_joint.y, srcBone.prev_joint.z };
                 bone.nextJoint = { srcBone.next_joint.x, srcBone.next_joint.y, srcBone.next_joint.z };
                 bone.width = srcBone.width;
                 bone.rotation = { srcBone.rotation.w, srcBone.rotation.x, srcBone.rotation.y, srcBone.rotation.z };
-                finger.bones.push_back(bone);
             }
-            hand.fingers.push_back(finger);
         }
         hand.pinchStrength = srcHand.pinch_strength;
         hand.grabStrength = srcHand.grab_strength;
         hand.confidence = srcHand.confidence;
         hand.visibleTime = srcHand.visible_time;
-        frame.hands.push_back(hand);
     }
-    return frame;
 }
 } // end anonymous namespace
 
 LeapPoller::LeapPoller(LEAP_CONNECTION connection)
-    : connection_(connection) {}
+    : connection_(connection) {
+    trackingFrame_.hands.reserve(MAX_HANDS_PER_FRAME);
+    interpolator_.getFrameSize = [](LEAP_CONNECTION c, LEAP_DEVICE d, int64_t timestamp, uint64_t* size) {
+        return LeapGetFrameSizeEx(c, d, timestamp, size);
+    };
+    interpolator_.interpolateFrame = [](LEAP_CONNECTION c, LEAP_DEVICE d, int64_t timestamp, LEAP_TRACKING_EVENT* event, uint64_t size) {
+        return LeapInterpolateFrameEx(c, d, timestamp, event, size);
+    };
+}
 
 LeapPoller::~LeapPoller() {
     cleanup();
@@ -265,22 +273,51 @@ void LeapPoller::handleDeviceLost(const LEAP_DEVICE_EVENT* deviceEvent) {
     }
 }
 
-// This function now converts the event and calls the callback
+// This function now converts the event and calls the callback.
+// Runs once per tracking event: must not allocate (see test_ZeroAllocation).
 void LeapPoller::handleTracking(const LEAP_TRACKING_EVENT* tracking, const std::string& serialNumber) {
-    LOG("LeapPoller::handleTracking called for SN: " + serialNumber);
+#ifdef VERBOSE_LEAP_LOGGING
+    OutputDebugStringA("LeapPoller::handleTracking called\n");
+#endif
     // Check if the callback is valid before proceeding
     if (frameCallback_) {
-        // Perform conversion here
-        FrameData frame = convertLeapToFrameData(tracking, serialNumber); // Use the converter
-        // Call the callback with the converted data
-        frameCallback_(frame);
-    } else {
-        // Optional: Log that frame was skipped due to null callback (might be noisy)
-        // std::cerr << "[LeapPoller] Frame skipped for device " << serialNumber << ": callback is null." << std::endl;
+        convertLeapToFrameData(tracking, serialNumber, trackingFrame_);
+        frameCallback_(trackingFrame_);
+    }
+}
+
+// Runs once per device per output tick: must not allocate once the buffer
+// has grown to the largest frame (see test_ZeroAllocation).
+bool LeapPoller::sampleDevice(const DeviceInfo& device, int64_t timestampUs) {
+    if (!frameCallback_ || !interpolator_.getFrameSize || !interpolator_.interpolateFrame) return false;
+    uint64_t size = 0;
+    // Fails until the device has frames around timestampUs; nothing to send yet
+    if (interpolator_.getFrameSize(connection_, device.deviceHandle, timestampUs, &size) != eLeapRS_Success || size == 0) {
+        return false;
+    }
+    const size_t words = static_cast<size_t>((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    if (interpolationBuffer_.size() < words) interpolationBuffer_.resize(words);
+    auto* event = reinterpret_cast<LEAP_TRACKING_EVENT*>(interpolationBuffer_.data());
+    const eLeapRS result = interpolator_.interpolateFrame(connection_, device.deviceHandle, timestampUs, event, size);
+    if (result != eLeapRS_Success) {
+#ifdef VERBOSE_LEAP_LOGGING
+        LOG_ERR("LeapInterpolateFrameEx failed for " << device.serialNumber << ": " << GetLeapRSString(result));
+#endif
+        return false;
+    }
+    handleTracking(event, device.serialNumber);
+    return true;
+}
+
+size_t LeapPoller::sampleAt(int64_t timestampUs) {
+    size_t sampled = 0;
+    for (const DeviceInfo& device : devices_) {
+        if (sampleDevice(device, timestampUs)) ++sampled;
     }
+    return sampled;
 }
 
-void LeapPoller::poll() {
+bool LeapPoller::poll(uint32_t timeoutMs) {
     // Poll Leap connection for a single event or timeout
     LEAP_CONNECTION_MESSAGE msg = { 0 };
 
@@ -293,14 +330,16 @@ void LeapPoller::poll() {
     }
 #endif
 
-    eLeapRS result = LeapPollConnection(connection_, 30, &msg); // Poll once with timeout (Reduced from 100ms)
+    eLeapRS result = LeapPollConnection(connection_, timeoutMs, &msg); // Poll once with timeout
     if (result != eLeapRS_Success && result != eLeapRS_Timeout) { // Ignore timeout errors, log others
         std::cerr << "LeapPollConnection failed: " << GetLeapRSString(result) << std::endl;
-        return; // Or handle error more robustly
+        return false; // Or handle error more robustly
     }
 
-    // Log the received event type (always, including None)
-    LOG("LeapPoller::poll() received event type: " + std::to_string(msg.type) + ", result: " + GetLeapRSString(result));
+#ifdef VERBOSE_LEAP_LOGGING
+    // Log the received event type (including None)
+    LOG("LeapPoller::poll() received event type: " << msg.type << ", result: " << GetLeapRSString(result));
+#endif
 
     switch (msg.type) {
     case eLeapEventType_None: // Expected on timeout
@@ -319,13 +358,12 @@ void LeapPoller::poll() {
         handleDeviceLost(msg.device_event);
         break;
     case eLeapEventType_Tracking:
-        if (msg.tracking_event) {
+        if (msg.tracking_event && forwardTrackingEvents_) {
             // Use msg.device_id to find the correct device
             auto it = std::find_if(devices_.begin(), devices_.end(),
                 [&](const DeviceInfo& info){ return info.id == msg.device_id; });
             if (it != devices_.end()) {
-                std::string trackingDeviceSerial = it->serialNumber;
-                handleTracking(msg.tracking_event, trackingDeviceSerial);
+                handleTracking(msg.tracking_event, it->serialNumber);
             } else {
                 std::cerr << "[LeapPoller] Warning: Tracking event for unknown device id: " << msg.device_id << std::endl;
             }
@@ -367,6 +405,7 @@ void LeapPoller::poll() {
             leapInputCallback_->onLeapServiceDisconnect();
         }
     }
+    return msg.type != eLeapEventType_None;
 }
 
 const std::vector<LeapPoller::DeviceInfo>& LeapPoller::getDevices() const {
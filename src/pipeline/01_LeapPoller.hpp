@@ -27,8 +27,17 @@ public:
     };
 
 
+    // The frame passed to the callback is reused for the next tracking event;
+    // copy out anything that must outlive the call.
     using FrameCallback = std::function<void(const FrameData& frame)>;
 
+    // LeapC's per-device frame interpolation, behind a seam so tests can stand
+    // in for the service. Defaults to LeapGetFrameSizeEx/LeapInterpolateFrameEx.
+    struct FrameInterpolator {
+        std::function<eLeapRS(LEAP_CONNECTION, LEAP_DEVICE, int64_t timestamp, uint64_t* size)> getFrameSize;
+        std::function<eLeapRS(LEAP_CONNECTION, LEAP_DEVICE, int64_t timestamp, LEAP_TRACKING_EVENT* event, uint64_t size)> interpolateFrame;
+    };
+
     LeapPoller(LEAP_CONNECTION connection);
     ~LeapPoller();
 
@@ -36,7 +45,19 @@ public:
     void handleDeviceEvent(const LEAP_DEVICE_EVENT* deviceEvent);
     void handleDeviceLost(const LEAP_DEVICE_EVENT* deviceEvent);
     void handleTracking(const LEAP_TRACKING_EVENT* tracking, const std::string& serialNumber);
-    void poll();
+    // Handles one pending event, waiting up to timeoutMs for it; returns
+    // whether there was one.
+    bool poll(uint32_t timeoutMs = 30);
+
+    // Interpolated input: each device's frame at timestampUs (LeapGetNow
+    // clock), converted and passed to the frame callback like a tracking
+    // event. The event buffer is reused, growing only for a larger frame.
+    // Returns how many devices produced a frame.
+    size_t sampleAt(int64_t timestampUs);
+    bool sampleDevice(const DeviceInfo& device, int64_t timestampUs);
+    void setFrameInterpolator(FrameInterpolator interpolator) { interpolator_ = std::move(interpolator); }
+    // Off while sampling by interpolation, so tracking events are not forwarded twice.
+    void setForwardTrackingEvents(bool forward) { forwardTrackingEvents_ = forward; }
 
     const std::vector<DeviceInfo>& getDevices() const;
     void setFrameCallback(FrameCallback cb);
@@ -57,7 +78,11 @@ public:
 private:
     LEAP_CONNECTION connection_;
     std::vector<DeviceInfo> devices_;
+    FrameData trackingFrame_; // Conversion target reused for every tracking event
     FrameCallback frameCallback_;
+    FrameInterpolator interpolator_;
+    std::vector<uint64_t> interpolationBuffer_; // uint64_t for the event's alignment
+    bool forwardTrackingEvents_ = true;
     DeviceConnectedCallback onDeviceConnected_;
     DeviceLostCallback onDeviceLost_;
     LeapInputCallback* leapInputCallback_ = nullptr;
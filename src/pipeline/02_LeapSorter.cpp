@@ -1,64 +1,103 @@
 #include "02_LeapSorter.hpp"
-#include <algorithm> // Needed for std::transform
+#include <algorithm>
 #include <cctype>    // Needed for ::toupper
-// #include "FrameData.hpp" // REMOVED - Included via header
 // Renamed: 02_LeapSorter
 
 LeapSorter::LeapSorter(FilteredFrameCallback onFilteredFrame) // Renamed: 02_LeapSorter
     : onFilteredFrame_(std::move(onFilteredFrame)) {}
 
+LeapSorter::HandFilter LeapSorter::handFilterFromString(const std::string& handType) {
+    std::string upper(handType);
+    std::transform(upper.begin(), upper.end(), upper.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    if (upper == "LEFT") return HandFilter::Left;
+    if (upper == "RIGHT") return HandFilter::Right;
+    return HandFilter::All; // "", "NONE" or unknown: pass everything through
+}
+
+LeapSorter::HandFilter LeapSorter::Assignments::find(const std::string& serialNumber) const {
+    for (const auto& [serial, filter] : bySerial) {
+        if (serial == serialNumber) return filter;
+    }
+    return HandFilter::All;
+}
+
+void LeapSorter::resolveSlots(Assignments& assignments) const {
+    assignments.bySlot.fill(HandFilter::All);
+    assignments.resolvedSlots = 0;
+    if (!deviceSlots_) return;
+    // Read the count first: a slot handed out after this is caught by the
+    // resolvedSlots check in lookupFilter() and resolved then.
+    assignments.resolvedSlots = deviceSlots_->size();
+    for (const auto& [serial, filter] : assignments.bySerial) {
+        const uint8_t slot = deviceSlots_->find(serial);
+        if (slot != INVALID_DEVICE_SLOT && slot < assignments.resolvedSlots) {
+            assignments.bySlot[slot] = filter;
+        }
+    }
+}
+
 void LeapSorter::setDeviceHand(const std::string& serialNumber, const std::string& handType) {
-    std::lock_guard<std::mutex> lock(assignmentMutex_);
-    if (handType.empty()) {
-        deviceHandAssignments_.erase(serialNumber);
+    const HandFilter filter = handFilterFromString(handType);
+    assignments_.update([&](Assignments& next) {
+        auto it = std::find_if(next.bySerial.begin(), next.bySerial.end(),
+                               [&](const auto& entry) { return entry.first == serialNumber; });
+        if (filter == HandFilter::All) {
+            if (it != next.bySerial.end()) next.bySerial.erase(it);
+        } else if (it != next.bySerial.end()) {
+            it->second = filter;
+        } else {
+            next.bySerial.emplace_back(serialNumber, filter);
+        }
+        resolveSlots(next);
+    });
+    if (filter == HandFilter::All) {
         LOG("Cleared hand assignment for device: " << serialNumber);
     } else {
-        deviceHandAssignments_[serialNumber] = handType;
         LOG("Assigned device " << serialNumber << " to hand: " << handType);
     }
     // TODO: Persist this change? (e.g., call configManager->setDefaultHandAssignment(serialNumber, handType))
 }
 
-void LeapSorter::processFrame(const std::string& serialNumber, const FrameData& frame) {
-    bool hasHands = !frame.hands.empty();
-    // Only log processing if hands are present - COMMENTED OUT
-    // if (hasHands) {
-    //     LOG("[LeapSorter] Processing frame for SN: " << serialNumber.c_str() << " with " << frame.hands.size() << " hands.");
-    // }
+LeapSorter::HandFilter LeapSorter::lookupFilter(const std::string& serialNumber, const FrameData& frame) {
+    std::shared_ptr<const Assignments> assignments = assignments_.load();
+    const uint8_t slot = frame.deviceSlot;
+    if (slot == INVALID_DEVICE_SLOT || !deviceSlots_) {
+        return assignments->find(serialNumber);
+    }
+    if (slot >= assignments->resolvedSlots) {
+        // First frame from a device that got its slot after the last
+        // assignment change; publish a snapshot that covers it. Once per device.
+        assignments_.update([this](Assignments& next) { resolveSlots(next); });
+        assignments = assignments_.load();
+    }
+    return assignments->bySlot[slot];
+}
 
-    FrameData filteredFrame;
-    filteredFrame.deviceId = frame.deviceId;
-    filteredFrame.timestamp = frame.timestamp;
+// Per-frame path: one atomic load of the assignment snapshot, an array index
+// and one enum compare per hand. No locks, no copies, no allocations.
+HandMask LeapSorter::selectHands(const std::string& serialNumber, const FrameData& frame) {
+    const HandFilter filter = lookupFilter(serialNumber, frame);
+    const HandType wanted = filter == HandFilter::Left ? HandType::Left : HandType::Right;
 
-    auto it = deviceHandAssignments_.find(serialNumber);
-    if (it == deviceHandAssignments_.end()) {
-        // No specific assignment, pass through all hands
-        filteredFrame.hands = frame.hands;
-    } else {
-        const std::string& assigned = it->second;
-        if (assigned.empty() || assigned == "NONE") {
-             // Explicitly assigned to NONE or empty string, pass through all hands
-            filteredFrame.hands = frame.hands;
-        } else {
-            // Filter based on assigned hand type
-            for (const auto& hand : frame.hands) {
-                 std::string handTypeLower = hand.handType;
-                 std::string handTypeUpper = handTypeLower;
-                 std::transform(handTypeUpper.begin(), handTypeUpper.end(), handTypeUpper.begin(), ::toupper);
-                 bool match = (handTypeUpper == assigned);
-                 LOG("[LeapSorter] SN: " << serialNumber << " | Assigned: '" << assigned << "' | Hand type (raw): '" << handTypeLower << "' | Hand type (upper): '" << handTypeUpper << "' | Match: " << (match ? "YES" : "NO"));
-                 // Compare uppercase version with the assignment (which is expected to be uppercase)
-                 if (match) { 
-                     filteredFrame.hands.push_back(hand);
-                 }
-            }
-        }
+    HandMask hands = 0;
+    for (size_t i = 0; i < frame.hands.size(); ++i) {
+        const bool match = filter == HandFilter::All || frame.hands[i].handType == wanted;
+#ifdef VERBOSE_LEAP_LOGGING
+        LOG("[LeapSorter] SN: " << serialNumber << " | Hand type: '" << handTypeName(frame.hands[i].handType) << "' | Match: " << (match ? "YES" : "NO"));
+#endif
+        if (match) hands |= handBit(i);
     }
+    return hands;
+}
+
+void LeapSorter::processFrame(const std::string& serialNumber, const FrameData& frame) {
+    const HandMask hands = selectHands(serialNumber, frame);
 
     // Only call callback if there's a listener
     if (onFilteredFrame_) {
-        onFilteredFrame_(serialNumber, filteredFrame);
-    } else if (hasHands) { // Log warning only if we dropped a frame with hands
+        onFilteredFrame_(serialNumber, frame, hands);
+    } else if (!frame.hands.empty()) { // Log warning only if we dropped a frame with hands
         LOG("WARN: [LeapSorter] SN: " << serialNumber.c_str() << " - onFilteredFrame_ callback is null! Dropping frame with hands.");
     }
 }
@@ -1,29 +1,57 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
+#include <array>
 #include <functional>
-#include <map>
-#include <mutex>
+#include <utility>
 #include <vector>
 #include "../core/Log.hpp"
 #include "../core/FrameData.hpp"
+#include "../core/DeviceSlotTable.hpp"
+#include "../utils/AtomicSnapshot.h"
 
 class LeapSorter {
 public:
-    // Ensure callback passes serialNumber
-    using FilteredFrameCallback = std::function<void(const std::string& serialNumber, const FrameData& frame)>;
+    // Receives the original frame and the hands of it that pass the device's
+    // assignment; the frame itself is never filtered or copied.
+    using FilteredFrameCallback = std::function<void(const std::string& serialNumber, const FrameData& frame, HandMask hands)>;
+
+    // Which hands of a device are passed on.
+    enum class HandFilter : uint8_t { All, Left, Right };
 
     explicit LeapSorter(FilteredFrameCallback onFilteredFrame);
 
-    // Assign device to hand type ("left", "right", or "")
+    // Slot table that stamps FrameData::deviceSlot (FrameChannel::deviceSlots()).
+    // Without one, or for frames without a slot, assignments are looked up by serial.
+    void setDeviceSlots(const DeviceSlotTable* slots) { deviceSlots_ = slots; }
+
+    // Assign device to hand type ("LEFT", "RIGHT", "NONE" or ""). Any thread.
     void setDeviceHand(const std::string& deviceId, const std::string& handType);
 
-    // Process a frame for a device
+    // Process a frame for a device. Lock-free: reads the current assignment snapshot.
+    // Makes one pass over the hands to build the mask handed to the callback.
     void processFrame(const std::string& deviceId, const FrameData& frame);
 
+    // The mask processFrame() passes on, without calling back. Any thread, so
+    // FrameWorkerPool workers call it directly.
+    HandMask selectHands(const std::string& deviceId, const FrameData& frame);
+
+    static HandFilter handFilterFromString(const std::string& handType);
+
 private:
-    std::map<std::string, std::string> deviceHandAssignments_;
+    // Immutable once published. bySlot mirrors bySerial for every slot below resolvedSlots.
+    struct Assignments {
+        std::vector<std::pair<std::string, HandFilter>> bySerial;
+        std::array<HandFilter, MAX_TRACKED_DEVICES> bySlot{};
+        size_t resolvedSlots = 0;
+
+        HandFilter find(const std::string& serialNumber) const;
+    };
+
+    void resolveSlots(Assignments& assignments) const;
+    HandFilter lookupFilter(const std::string& serialNumber, const FrameData& frame);
+
+    AtomicSnapshot<Assignments> assignments_;
+    const DeviceSlotTable* deviceSlots_ = nullptr;
     FilteredFrameCallback onFilteredFrame_;
-    std::mutex assignmentMutex_;
 };
@@ -1,187 +1,404 @@
 #include "03_DataProcessor.hpp"
+#include "../core/HandFeatures.hpp"
+#include "../core/PoseClassifier.hpp"
+#include "../core/SkeletonPacket.hpp"
 #include <mutex>
 #include <cmath>
 #include <algorithm>
 #include <iostream>
 
-// --- Normalization bounds (file scope) ---
-static constexpr float X_MIN = -150.f, X_MAX = 150.f;
-static constexpr float Y_MIN =  80.f,  Y_MAX = 380.f;
-static constexpr float Z_MIN = -120.f, Z_MAX = 120.f;
-static constexpr float X_RANGE = X_MAX - X_MIN;
-static constexpr float Y_RANGE = Y_MAX - Y_MIN;
-static constexpr float Z_RANGE = Z_MAX - Z_MIN;
-
 // Corrected Constructor
 DataProcessor::DataProcessor(DeviceAliasManager& aliasManager, 
-                           std::function<void(const OscMessage&)> onOscMessage,
-                           std::function<void(const FrameData&)> onUiEvent,
+                           OscMessageCallback onOscMessage,
+                           UiEventCallback onUiEvent,
                            std::shared_ptr<AppLogger> logger) 
     : aliasManager_(aliasManager),
       onOscMessage_(std::move(onOscMessage)),
       onUiEvent_(std::move(onUiEvent)),
-      logger_(std::move(logger)), 
-      // Initialize ALL filters, including new ones
-      sendPalm_(true), sendWrist_(true), 
-      sendThumb_(true), sendIndex_(true), sendMiddle_(true), sendRing_(true), sendPinky_(true),
-      sendPalmOrientation_(false), sendPalmVelocity_(false), sendPalmNormal_(false),
-      sendVisibleTime_(false), sendFingerIsExtended_(false),
-      sendPinchStrength_(true), sendGrabStrength_(true) 
+      logger_(std::move(logger))
 {
     // Constructor body (if any)
 }
 
-// Helper function for sending OSC messages
-void DataProcessor::sendOscMessage(const std::string& alias, const std::string& handType, const std::string& dataType, const std::string& subType, float value) {
-    std::string address = "/leap/" + alias + "/" + handType + "/" + dataType;
-    if (!subType.empty()) {
-        address += "/" + subType;
-    }
-    OscMessage msg;
-    msg.address = address;
-    msg.values.push_back(value);
-    onOscMessage_(msg);
-}
-
-// Helper function to send zero values for a specific hand type
-void DataProcessor::sendZeroValues(const std::string& serialNumber, const std::string& alias, const std::string& handType) {
-    // Palm
-    if (sendPalm_) {
-        sendOscMessage(alias, handType, "palm", "tx", 0.f);
-        sendOscMessage(alias, handType, "palm", "ty", 0.f);
-        sendOscMessage(alias, handType, "palm", "tz", 0.f);
-    }
-    // Wrist
-    if (sendWrist_) {
-        sendOscMessage(alias, handType, "wrist", "tx", 0.f);
-        sendOscMessage(alias, handType, "wrist", "ty", 0.f);
-        sendOscMessage(alias, handType, "wrist", "tz", 0.f);
-    }
-    // Fingers
-    static const char* fingerNames[5] = {"thumb", "index", "middle", "ring", "pinky"};
-    const bool fingerFilters[] = { sendThumb_, sendIndex_, sendMiddle_, sendRing_, sendPinky_ };
-    for (size_t f = 0; f < 5; ++f) {
-        const std::string fingerName = fingerNames[f];
-        if (fingerFilters[f]) {
-            sendOscMessage(alias, handType, "finger/" + fingerName, "tx", 0.f);
-            sendOscMessage(alias, handType, "finger/" + fingerName, "ty", 0.f);
-            sendOscMessage(alias, handType, "finger/" + fingerName, "tz", 0.f);
-            sendOscMessage(alias, handType, "finger/" + fingerName, "exists", 0.f);
-            if (sendFingerIsExtended_) {
-                sendOscMessage(alias, handType, "finger/" + fingerName, "isExtended", 0.f);
-            }
+namespace {
+const char* const HAND_NAMES[2] = { "left", "right" };
+
+size_t handIndex(HandType handType) {
+    return static_cast<size_t>(handType);
+}
+}
+
+DataProcessor::DeviceState& DataProcessor::getDeviceState(const std::string& serialNumber, uint8_t deviceSlot) {
+    const bool hasSlot = deviceSlot < MAX_TRACKED_DEVICES;
+    if (hasSlot && slotDevices_[deviceSlot]) return *slotDevices_[deviceSlot];
+
+    auto it = devices_.find(serialNumber);
+    if (it != devices_.end()) {
+        if (hasSlot) slotDevices_[deviceSlot] = &it->second;
+        return it->second;
+    }
+
+    // First frame from this device: build every address once.
+    DeviceState& device = devices_[serialNumber];
+    if (hasSlot) slotDevices_[deviceSlot] = &device; // map nodes never move
+    device.alias = aliasManager_.getOrAssignAlias(serialNumber);
+    const auto& channels = oscChannels();
+    for (size_t h = 0; h < 2; ++h) {
+        const std::string prefix = "/leap/" + device.alias + "/" + HAND_NAMES[h] + "/";
+        auto& table = device.addresses[h];
+        table.reserve(channels.size());
+        for (const OscChannel& channel : channels) {
+            table.push_back(prefix + channel.address);
+        }
+        device.skeletonAddresses[h] = prefix + "skeleton";
+        for (size_t e = 0; e < GESTURE_EVENT_COUNT; ++e) {
+            device.eventAddresses[h][e] = prefix + "event/" + gestureEventAddress(static_cast<GestureEvent>(e));
+        }
+    }
+    return device;
+}
+
+// Helper function for sending OSC messages.
+// Assigning into scratchMessage_ reuses its capacity, so this doesn't allocate
+// once the longest address has been seen.
+void DataProcessor::sendOscMessage(const std::string& address, float value) {
+    scratchMessage_.address = address;
+    scratchMessage_.values.clear();
+    scratchMessage_.values.push_back(value);
+    onOscMessage_(scratchMessage_);
+}
+
+void DataProcessor::sendEvents(const DeviceState& device, size_t hand, GestureEvents events, const ProcessingConfig& config) {
+    if (!events || !(config.fields & oscFieldBit(OscField::Gestures))) return;
+    for (size_t e = 0; e < GESTURE_EVENT_COUNT; ++e) {
+        if (!(events & gestureEventBit(static_cast<GestureEvent>(e)))) continue;
+        eventMessage_.address = device.eventAddresses[hand][e];
+        eventMessage_.values.assign(1, 1.f);
+        if (onOscEvent_) {
+            onOscEvent_(eventMessage_);
+        } else {
+            onOscMessage_(eventMessage_);
+        }
+    }
+}
+
+// Built off the loss path: once per device and again after a config change,
+// so a hand or device loss only hands over prebuilt bundles.
+void DataProcessor::prepareZeroBundles(DeviceState& device, const ProcessingConfig& config) {
+    if (device.zeroBundlesVersion == config.version) return;
+    for (size_t h = 0; h < 2; ++h) {
+        auto& messages = device.zeroBundles[h].messages;
+        messages.resize(config.plan.zeroOnLoss.size());
+        for (size_t i = 0; i < messages.size(); ++i) {
+            messages[i].address = device.addresses[h][config.plan.zeroOnLoss[i]];
+            messages[i].values.assign(1, 0.f);
+        }
+    }
+    device.zeroBundlesVersion = config.version;
+}
+
+void DataProcessor::sendZeroValues(const DeviceState& device, size_t hand, const ProcessingConfig& config) {
+    const OscBundle& bundle = device.zeroBundles[hand];
+    if (bundle.messages.empty()) return;
+    const uint32_t repeats = config.zeroBundleRepeats > 0 ? config.zeroBundleRepeats : 1;
+    for (uint32_t i = 0; i < repeats; ++i) {
+        if (onOscBundle_) {
+            onOscBundle_(bundle);
+        } else {
+            for (const OscMessage& message : bundle.messages) onOscMessage_(message);
+        }
+    }
+}
+
+void DataProcessor::releaseSlot(DeviceState& device, size_t hand, GestureEvents events, const ProcessingConfig& config) {
+    if (HandState* state = device.hands.find(device.slotKeys[hand])) {
+        events |= state->gestures.release();
+        device.hands.evict(device.slotKeys[hand]);
+    }
+    sendEvents(device, hand, events, config);
+    device.slotKeys[hand] = NO_HAND_KEY;
+    device.pointerGains[hand].reset(); // Keeps the cursors where they are
+}
+
+void DataProcessor::releaseEvicted(DeviceState& device, uint32_t key, HandState& state, const ProcessingConfig& config) {
+    sendEvents(device, state.hand, state.gestures.release(), config);
+    if (device.slotKeys[state.hand] == key) {
+        device.slotKeys[state.hand] = NO_HAND_KEY;
+        device.pointerGains[state.hand].reset();
+    }
+}
+
+void DataProcessor::resetDevice(DeviceState& device, const ProcessingConfig& config) {
+    for (size_t h = 0; h < 2; ++h) {
+        if (device.reported & handPresenceBit(static_cast<HandType>(h))) {
+            releaseSlot(device, h, gestureEventBit(GestureEvent::HandExit), config);
+            sendZeroValues(device, h, config);
+        }
+    }
+    device.hands.clear();
+    device.slotKeys = { NO_HAND_KEY, NO_HAND_KEY };
+    for (PointerGain& gain : device.pointerGains) gain.reset();
+    device.reported = 0;
+    device.holding = 0;
+}
+
+// Called when the UI toggles a field. The plan is compiled here, outside the
+// per-frame path, and published as a whole with the mask it belongs to.
+void DataProcessor::setFieldMask(OscFieldMask fields) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.fields = fields;
+        next.plan = compileEmissionPlan(next.fields, next.positionOutput);
+    });
+}
+
+void DataProcessor::setPositionOutput(PositionOutput output) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.positionOutput = output;
+        next.plan = compileEmissionPlan(next.fields, next.positionOutput);
+    });
+}
+
+void DataProcessor::setInteractionBoxes(const std::map<std::string, InteractionBox>& boxes, bool learn) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.interactionBoxes = boxes;
+        next.learnInteractionBoxes = learn;
+    });
+}
+
+void DataProcessor::setHandLossHold(uint32_t frames, uint32_t milliseconds) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.lossHoldFrames = frames;
+        next.lossHoldMs = milliseconds;
+    });
+}
+
+void DataProcessor::setZeroBundleRepeats(uint32_t repeats) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.zeroBundleRepeats = repeats > 0 ? repeats : 1;
+    });
+}
+
+void DataProcessor::setSmoothing(const SmoothingConfig& smoothing) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.smoothing = smoothing;
+    });
+}
+
+void DataProcessor::setPrediction(const PredictionConfig& prediction) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.prediction = prediction;
+    });
+}
+
+uint64_t DataProcessor::predictionLookaheadUs(DeviceState& device, uint64_t timestamp, const PredictionConfig& prediction) {
+    float lookaheadUs = prediction.lookaheadMs * 1000.0f;
+    if (prediction.toSendTime && clock_) {
+        const uint64_t now = clock_();
+        if (now >= timestamp) {
+            // Smoothed over ~10 frames so scheduling jitter doesn't shake the output
+            const float age = static_cast<float>(now - timestamp);
+            device.latencyUs = device.latencyUs < 0.0f ? age : device.latencyUs + 0.1f * (age - device.latencyUs);
+        }
+        if (device.latencyUs > 0.0f) lookaheadUs += device.latencyUs;
+    }
+    lookaheadUs = (std::min)((std::max)(lookaheadUs, 0.0f), prediction.maxExtrapolationMs * 1000.0f);
+    return static_cast<uint64_t>(lookaheadUs);
+}
+
+void DataProcessor::setGainCurve(const GainCurve& curve) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.gainCurve = curve;
+    });
+}
+
+void DataProcessor::setSkeletonQuantized(bool quantized) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.skeletonQuantized = quantized;
+    });
+}
+
+void DataProcessor::setGestures(const GestureConfig& gestures) {
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.gestures = gestures;
+    });
+}
+
+void DataProcessor::setPoses(std::shared_ptr<const PoseLibrary> library, const PoseMatchConfig& match) {
+    if (!library) library = std::make_shared<const PoseLibrary>();
+    config_.update([&](ProcessingConfig& next) {
+        ++next.version;
+        next.poses = std::move(library);
+        next.poseMatch = match;
+    });
+}
+
+void DataProcessor::setPoses(const std::vector<PoseTemplate>& poses, const PoseMatchConfig& match) {
+    setPoses(std::make_shared<const PoseLibrary>(poses), match);
+}
+
+void DataProcessor::updatePresence(DeviceState& device, HandPresence current, uint64_t timestamp, const ProcessingConfig& config) {
+    for (size_t h = 0; h < 2; ++h) {
+        const HandPresence bit = handPresenceBit(static_cast<HandType>(h));
+        if (current & bit) { // Appeared, or came back within the hold
+            if (!(device.reported & bit)) sendEvents(device, h, gestureEventBit(GestureEvent::HandEnter), config);
+            device.reported |= bit;
+            device.holding &= static_cast<HandPresence>(~bit);
+            continue;
+        }
+        if (!(device.reported & bit)) continue;
+
+        if (!(device.holding & bit)) {
+            device.holding |= bit;
+            device.missingFrames[h] = 0;
+            device.missingSinceUs[h] = timestamp;
+        }
+        ++device.missingFrames[h];
+        const bool byFrames = config.lossHoldFrames > 0 && device.missingFrames[h] > config.lossHoldFrames;
+        const bool byTime = config.lossHoldMs > 0 && timestamp >= device.missingSinceUs[h] &&
+                            timestamp - device.missingSinceUs[h] >= uint64_t(config.lossHoldMs) * 1000;
+        const bool noHold = config.lossHoldFrames == 0 && config.lossHoldMs == 0;
+        if (noHold || byFrames || byTime) {
+            // A returning hand starts from fresh state, from its new position
+            releaseSlot(device, h, gestureEventBit(GestureEvent::HandExit), config);
+            sendZeroValues(device, h, config);
+            device.reported &= static_cast<HandPresence>(~bit);
+            device.holding &= static_cast<HandPresence>(~bit);
         }
     }
-    // Pinch/Grab/VisibleTime
-    if (sendPinchStrength_) sendOscMessage(alias, handType, "pinchStrength", "", 0.f);
-    if (sendGrabStrength_) sendOscMessage(alias, handType, "grabStrength", "", 0.f);
-    if (sendVisibleTime_) sendOscMessage(alias, handType, "visibleTime", "", 0.f);
-}
-
-// Updated setFilterSettings implementation (14 bools):
-void DataProcessor::setFilterSettings(
-    bool sendPalm, bool sendWrist,
-    bool sendThumb, bool sendIndex, bool sendMiddle,
-    bool sendRing, bool sendPinky,
-    bool sendPalmOrientation, bool sendPalmVelocity, bool sendPalmNormal,
-    bool sendVisibleTime, bool sendFingerIsExtended,
-    bool sendPinchStrength, bool sendGrabStrength 
-) {
-    sendPalm_ = sendPalm;
-    sendWrist_ = sendWrist;
-    sendThumb_ = sendThumb;
-    sendIndex_ = sendIndex;
-    sendMiddle_ = sendMiddle;
-    sendRing_ = sendRing;
-    sendPinky_ = sendPinky;
-    sendPalmOrientation_ = sendPalmOrientation; 
-    sendPalmVelocity_ = sendPalmVelocity;
-    sendPalmNormal_ = sendPalmNormal;
-    sendVisibleTime_ = sendVisibleTime;
-    sendFingerIsExtended_ = sendFingerIsExtended;
-    sendPinchStrength_ = sendPinchStrength; 
-    sendGrabStrength_ = sendGrabStrength;
-}
-
-void DataProcessor::processData(const std::string& serialNumber, const FrameData& frame) {
-    std::string alias = aliasManager_.getOrAssignAlias(serialNumber);
-    AssignedHand mode = aliasManager_.getAssignedHand(alias);
-    auto want = [&](const std::string& ht) {
-        return (mode == AssignedHand::Both) ||
-               (mode == AssignedHand::Left  && ht == "left") ||
-               (mode == AssignedHand::Right && ht == "right");
-    };
-
-    // Collect current hands of interest
-    std::set<std::string> current;
-    for (const auto& hand : frame.hands) {
-        if (want(hand.handType))
-            current.insert(hand.handType);
-    }
-    std::set<std::string>& prev = lastSeenHandsPerDevice_[alias];
-    if (prev.count("left") && !current.count("left"))  sendZeroValues(serialNumber, alias, "left");
-    if (prev.count("right") && !current.count("right")) sendZeroValues(serialNumber, alias, "right");
-    prev.swap(current); // store for next frame
+}
+
+// Per-frame path: no allocations once the device has been seen (see test_ZeroAllocation).
+// Hand assignment has already been applied by LeapSorter; `hands` selects the
+// hands to emit, so this only tests one bit per hand.
+void DataProcessor::processData(const std::string& serialNumber, const FrameData& frame, HandMask hands) {
+    // One atomic load per frame; the whole frame uses this version even if
+    // setFieldMask() publishes a new one meanwhile, and holds it until done.
+    const std::shared_ptr<const ProcessingConfig> snapshot = config_.load();
+    const ProcessingConfig& config = *snapshot;
+    DeviceState& device = getDeviceState(serialNumber, frame.deviceSlot);
+    prepareZeroBundles(device, config);
+    if (frame.deviceLost) {
+        resetDevice(device, config);
+        return;
+    }
+
+    // Presence of the hands of interest, as a 2-bit mask. While it equals the
+    // reported mask and no hand is held, nothing changed and there is no work.
+    // Also which hand types still have the hand their outputs follow.
+    HandPresence current = 0;
+    HandPresence followed = 0;
+    for (size_t i = 0; i < frame.hands.size(); ++i) {
+        if (!(hands & handBit(i))) continue;
+        const HandPresence bit = handPresenceBit(frame.hands[i].handType);
+        current |= bit;
+        if (handStateKey(frame.hands[i]) == device.slotKeys[handIndex(frame.hands[i].handType)]) followed |= bit;
+    }
+    if ((device.reported ^ current) | device.holding) {
+        updatePresence(device, current, frame.timestamp, config);
+    }
+
+    const bool cursors = (config.fields & oscFieldBit(OscField::Cursor)) != 0;
+    const bool normalized = config.positionOutput != PositionOutput::Raw;
+    const bool skeleton = (config.fields & oscFieldBit(OscField::Skeleton)) != 0;
+    const bool pose = (config.fields & oscFieldBit(OscField::Pose)) != 0;
+    const bool features = (config.fields & HAND_FEATURE_FIELDS) != 0 || pose;
+    const bool gestures = (config.fields & oscFieldBit(OscField::Gestures)) != 0;
+    const bool smoothing = config.smoothing.anyEnabled();
+    const bool predicting = config.prediction.mode != PredictionMode::Off;
+    const uint64_t lookaheadUs = predicting ? predictionLookaheadUs(device, frame.timestamp, config.prediction) : 0;
+    if (smoothing && device.smoothersVersion != config.version) {
+        device.hands.forEach([&](HandState& state) { state.smoother.configure(config.smoothing); });
+        device.smoothersVersion = config.version;
+    }
+    if ((cursors || normalized) && device.normalizerVersion != config.version) {
+        const auto box = config.interactionBoxes.find(serialNumber);
+        if (box != config.interactionBoxes.end()) {
+            device.normalizer.configure(box->second, false);
+        } else {
+            device.normalizer.configure(InteractionBox(), config.learnInteractionBoxes);
+        }
+        device.normalizerVersion = config.version;
+    }
 
     // Normal hand processing (only for assigned hands)
-    for (const auto& hand : frame.hands) {
-        if (!want(hand.handType)) continue;
-        // --- Raw millimetres for OSC ---
-        Vector3 palmMm  = hand.palm.position;
-        Vector3 wristMm = hand.arm.isValid() ? hand.arm.wristPosition : palmMm;
-        std::string currentHandType = hand.handType;
-        if (sendPalm_) {
-            sendOscMessage(alias, currentHandType, "palm", "tx", palmMm.x);
-            sendOscMessage(alias, currentHandType, "palm", "ty", palmMm.y);
-            sendOscMessage(alias, currentHandType, "palm", "tz", palmMm.z);
-        }
-        if (sendWrist_ && hand.arm.isValid()) {
-            sendOscMessage(alias, currentHandType, "wrist", "tx", wristMm.x);
-            sendOscMessage(alias, currentHandType, "wrist", "ty", wristMm.y);
-            sendOscMessage(alias, currentHandType, "wrist", "tz", wristMm.z);
-        }
-        if (sendPinchStrength_) {
-            sendOscMessage(alias, currentHandType, "pinchStrength", "", hand.pinchStrength);
-        }
-        if (sendGrabStrength_) {
-            sendOscMessage(alias, currentHandType, "grabStrength", "", hand.grabStrength);
-        }
-        static const char* fingerNames[5] = {"thumb", "index", "middle", "ring", "pinky"};
-        const bool fingerFilters[] = { sendThumb_, sendIndex_, sendMiddle_, sendRing_, sendPinky_ };
-        for (size_t f = 0; f < 5; ++f) {
-            const std::string fingerName = fingerNames[f];
-            const bool fingerPosEnabled = fingerFilters[f];
-            const bool validFinger = f < hand.fingers.size() && hand.fingers[f].isValid() && hand.fingers[f].bones.size() > 3 && hand.fingers[f].bones[3].isValid();
-            if (fingerPosEnabled && validFinger) {
-                const Vector3 tipMm = hand.fingers[f].bones[3].nextJoint;
-                sendOscMessage(alias, currentHandType, "finger/" + fingerName, "tx", tipMm.x);
-                sendOscMessage(alias, currentHandType, "finger/" + fingerName, "ty", tipMm.y);
-                sendOscMessage(alias, currentHandType, "finger/" + fingerName, "tz", tipMm.z);
-            }
-            if (sendFingerIsExtended_ && validFinger) {
-                sendOscMessage(alias, currentHandType, "finger/" + fingerName, "isExtended", hand.fingers[f].isExtended ? 1.f : 0.f);
+    device.hands.beginFrame();
+    for (size_t i = 0; i < frame.hands.size(); ++i) {
+        if (!(hands & handBit(i))) continue;
+        const size_t h = handIndex(frame.hands[i].handType);
+        const HandPresence bit = handPresenceBit(frame.hands[i].handType);
+        const uint32_t key = handStateKey(frame.hands[i]);
+        if (key != device.slotKeys[h]) {
+            // Another hand of a type whose outputs already follow one: it
+            // would write the same addresses and fire gestures on them
+            if (followed & bit) continue;
+            // The hand the outputs followed is gone; this one takes them over
+            if (device.slotKeys[h] != NO_HAND_KEY) {
+                releaseSlot(device, h, gestureEventBit(GestureEvent::HandChange), config);
             }
+            device.slotKeys[h] = key;
+            followed |= bit;
+        }
+        bool isNew = false;
+        HandState& state = device.hands.acquire(key, isNew, [&](uint32_t evictedKey, HandState& evicted) {
+            releaseEvicted(device, evictedKey, evicted, config);
+        });
+        if (isNew) {
+            state.hand = static_cast<uint8_t>(h);
+            if (smoothing) state.smoother.configure(config.smoothing);
+        }
+
+        const HandData* source = &frame.hands[i];
+        if (smoothing || predicting) {
+            smoothedHand_ = *source; // Fixed-size copy, no allocation
+            if (smoothing) state.smoother.apply(smoothedHand_, frame.timestamp);
+            if (predicting) state.predictor.apply(smoothedHand_, frame.timestamp, lookaheadUs, config.prediction);
+            source = &smoothedHand_;
+        }
+        const HandData& hand = *source;
+        // Events first, ahead of the hand's continuous values
+        if (gestures) sendEvents(device, h, state.gestures.update(hand, frame.timestamp, config.gestures), config);
+        if (cursors || normalized) {
+            gatherHandPoints(hand, points_);
+            // Also learns the box, so cursors scale with it even without normalized output
+            device.normalizer.normalize(points_, derived_);
         }
-        if (sendPalmOrientation_) {
-            sendOscMessage(alias, currentHandType, "palm", "orientation/qw", hand.palm.orientation.w);
-            sendOscMessage(alias, currentHandType, "palm", "orientation/qx", hand.palm.orientation.x);
-            sendOscMessage(alias, currentHandType, "palm", "orientation/qy", hand.palm.orientation.y);
-            sendOscMessage(alias, currentHandType, "palm", "orientation/qz", hand.palm.orientation.z);
+        if (cursors) {
+            device.pointerGains[h].apply(hand, points_, frame.timestamp, config.gainCurve, device.normalizer.size(), derived_);
         }
-        if (sendPalmVelocity_) {
-            sendOscMessage(alias, currentHandType, "palm", "velocity/vx", hand.palm.velocity.x);
-            sendOscMessage(alias, currentHandType, "palm", "velocity/vy", hand.palm.velocity.y);
-            sendOscMessage(alias, currentHandType, "palm", "velocity/vz", hand.palm.velocity.z);
+        if (features) computeHandFeatures(hand, derived_);
+        if (pose) {
+            buildPoseFeatures(hand, derived_, poseFeatures_);
+            const PoseMatch match = config.poses->classify(poseFeatures_, config.poseMatch);
+            derived_.poseId = static_cast<float>(match.id);
+            derived_.poseScore = match.score;
         }
-        if (sendPalmNormal_) {
-            sendOscMessage(alias, currentHandType, "palm", "normal/nx", hand.palm.normal.x);
-            sendOscMessage(alias, currentHandType, "palm", "normal/ny", hand.palm.normal.y);
-            sendOscMessage(alias, currentHandType, "palm", "normal/nz", hand.palm.normal.z);
+        const auto& addr = device.addresses[h];
+        // Raw millimetres; channels whose arm/finger isn't valid this frame are skipped.
+        const uint32_t valid = handValidity(hand);
+        for (const OscEmission& emission : config.plan.live) {
+            if (emission.guard != OSC_GUARD_NONE && !(valid & (1u << emission.guard))) continue;
+            sendOscMessage(addr[emission.addressId], readChannelValue(hand, derived_, emission));
         }
-        if (sendVisibleTime_) {
-            float visibleSec = static_cast<float>(hand.visibleTime) / 1'000'000.0f;
-            sendOscMessage(alias, currentHandType, "visibleTime", "", visibleSec);
+        if (skeleton) {
+            // The whole skeleton as one blob; its buffer is reused like scratchMessage_'s
+            skeletonMessage_.address = device.skeletonAddresses[h];
+            encodeSkeleton(hand, config.skeletonQuantized, skeletonMessage_.blob);
+            onOscMessage_(skeletonMessage_);
         }
     }
-    onUiEvent_(frame);
+    // Hands gone from the frame lose their state, unless a loss hold still reports them
+    device.hands.evictUnseen(
+        [&](uint32_t key) { return key == device.slotKeys[HAND_LEFT] || key == device.slotKeys[HAND_RIGHT]; },
+        [&](uint32_t key, HandState& evicted) { releaseEvicted(device, key, evicted, config); });
+    if (onUiEvent_) onUiEvent_(frame, hands);
 }
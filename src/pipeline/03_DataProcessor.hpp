@@ -3,10 +3,13 @@
 #include <vector>
 #include <functional>
 #include <map>
-#include <set>
+#include <array>
 #include <mutex>
 #include <memory>
 #include "../core/FrameData.hpp"
+#include "../core/ProcessingConfig.hpp"
+#include "../core/HandStateTable.hpp"
+#include "../utils/AtomicSnapshot.h"
 #include "transport/osc/OscMessage.hpp"
 #include "../core/DeviceAliasManager.hpp"
 #include "../core/AppLogger.hpp"
@@ -15,7 +18,10 @@ class DataProcessor {
 public:
     // Callback types
     using OscMessageCallback = std::function<void(const OscMessage&)>;
-    using UiEventCallback = std::function<void(const FrameData&)>;
+    using UiEventCallback = std::function<void(const FrameData&, HandMask hands)>;
+    using OscBundleCallback = std::function<void(const OscBundle&)>;
+    // Current time on the clock of FrameData::timestamp (LeapGetNow()), in microseconds
+    using ClockCallback = std::function<uint64_t()>;
 
     /**
      * @param aliasManager Reference to DeviceAliasManager for serial-to-alias mapping.
@@ -25,66 +31,148 @@ public:
      */
     DataProcessor(DeviceAliasManager& aliasManager, OscMessageCallback onOscMessage, UiEventCallback onUiEvent, std::shared_ptr<AppLogger> logger);
 
-    // processData signature
-    void processData(const std::string& serialNumber, const FrameData& frame);
+    // Emits OSC for the hands selected by `hands` (LeapSorter's assignment mask);
+    // selected hands that stay missing past the loss hold are zeroed.
+    void processData(const std::string& serialNumber, const FrameData& frame, HandMask hands = ALL_HANDS);
     
-    // setFilterSettings declaration
-    void setFilterSettings(bool sendPalm, bool sendWrist, 
-                           bool sendThumb, bool sendIndex, bool sendMiddle, bool sendRing, bool sendPinky,
-                           bool sendPalmOrientation, bool sendPalmVelocity, bool sendPalmNormal,
-                           bool sendVisibleTime, bool sendFingerIsExtended,
-                           bool sendPinchStrength, bool sendGrabStrength);
+    // Enables the OSC fields in `fields` and compiles the emission plan for them.
+    // Any thread: publishes a new ProcessingConfig version, which processData()
+    // picks up at the start of its next frame.
+    void setFieldMask(OscFieldMask fields);
+    OscFieldMask getFieldMask() const { return config_.load()->fields; }
+
+    // How long a hand may be missing before it is zeroed (see ProcessingConfig).
+    // Any thread, like setFieldMask().
+    void setHandLossHold(uint32_t frames, uint32_t milliseconds);
+    // Any thread. Values below 1 are treated as 1.
+    void setZeroBundleRepeats(uint32_t repeats);
+    // One Euro smoothing of positions before they are sent (see HandSmoother). Any thread.
+    void setSmoothing(const SmoothingConfig& smoothing);
+    // Extrapolation of positions to the send time or a lookahead (see HandPredictor). Any thread.
+    void setPrediction(const PredictionConfig& prediction);
+    // Gain curve for the relative cursors (see PointerGain). Any thread.
+    void setGainCurve(const GainCurve& curve);
+    // Raw, normalized or both position forms (recompiles the plan). Any thread.
+    void setPositionOutput(PositionOutput output);
+    // Per-serial interaction boxes; devices without one learn theirs when
+    // learn is set. Any thread.
+    void setInteractionBoxes(const std::map<std::string, InteractionBox>& boxes, bool learn);
+    // Skeleton blob precision (see SkeletonPacket.hpp). Any thread.
+    void setSkeletonQuantized(bool quantized);
+    // Gesture event thresholds (see GestureDetector). Any thread.
+    void setGestures(const GestureConfig& gestures);
+    // Pose templates to match and how closely (see PoseClassifier). Any thread.
+    // The library is shared, not copied: one built library can be handed to
+    // every processor, and it is freed once no processor uses it.
+    void setPoses(std::shared_ptr<const PoseLibrary> library, const PoseMatchConfig& match);
+    void setPoses(const std::vector<PoseTemplate>& poses, const PoseMatchConfig& match);
+
+    // Receives the zero bundles sent on hand and device loss. Set before the
+    // first frame; without one their messages go through onOscMessage.
+    void setOscBundleCallback(OscBundleCallback onOscBundle) { onOscBundle_ = std::move(onOscBundle); }
+    // Receives the gesture events, /leap/<alias>/<hand>/event/<name> with a
+    // value of 1. A hand's events are sent before its continuous values of the
+    // same frame, so a receiver may route them on a faster path. Set before
+    // the first frame; without one they go through onOscMessage.
+    void setOscEventCallback(OscMessageCallback onOscEvent) { onOscEvent_ = std::move(onOscEvent); }
+    // Clock used to measure each frame's age for PredictionConfig::toSendTime.
+    // Set before the first frame; without one only the fixed lookahead applies.
+    void setClock(ClockCallback clock) { clock_ = std::move(clock); }
+
+    // Version of the config the next frame will use (0 = initial defaults).
+    uint64_t getConfigVersion() const { return config_.load()->version; }
 
 private:
-    // Helper function to send zero values for a specific hand type
-    void sendZeroValues(const std::string& serialNumber, const std::string& alias, const std::string& handType);
+    static constexpr size_t HAND_LEFT = static_cast<size_t>(HandType::Left);
+    static constexpr size_t HAND_RIGHT = static_cast<size_t>(HandType::Right);
+
+    // State of one tracked hand, filed by its id (see HandStateTable)
+    struct HandState {
+        HandSmoother smoother;
+        HandPredictor predictor;
+        GestureDetector gestures;
+        uint8_t hand = 0; // HAND_LEFT/HAND_RIGHT: whose addresses this hand drives
+    };
+    // Only the hand each hand type's outputs follow is processed and has state
+    using HandStates = HandStateTable<HandState, 2>;
+
+    // Per-device state. Addresses are built once when the device is first seen,
+    // so the per-frame path only copies preformatted strings.
+    struct DeviceState {
+        std::string alias;
+        std::array<std::vector<std::string>, 2> addresses; // [HAND_LEFT/HAND_RIGHT][address id], see oscChannels()
+        std::array<std::string, 2> skeletonAddresses;
+        std::array<std::array<std::string, GESTURE_EVENT_COUNT>, 2> eventAddresses;
+        HandPresence reported = 0; // Hands sent and not zeroed since
+        HandPresence holding = 0;  // Reported hands that are missing but still within the loss hold
+        std::array<uint32_t, 2> missingFrames = { 0, 0 };
+        std::array<uint64_t, 2> missingSinceUs = { 0, 0 }; // Frame timestamp of the first missing frame
+        // Zero-value bundle per hand for the plan of config version zeroBundlesVersion
+        std::array<OscBundle, 2> zeroBundles;
+        uint64_t zeroBundlesVersion = UINT64_MAX;
+        // Key of the hand each hand type's addresses are following (NO_HAND_KEY: none)
+        std::array<uint32_t, 2> slotKeys = { NO_HAND_KEY, NO_HAND_KEY };
+        // Filters, prediction and gestures of each followed hand;
+        // smoothers configured for config version smoothersVersion
+        HandStates hands;
+        // Relative cursor state per hand type: the cursors stay put while the
+        // hand is away or replaced, only the motion history is reset
+        std::array<PointerGain, 2> pointerGains;
+        uint64_t smoothersVersion = UINT64_MAX;
+        // Smoothed age of this device's frames
+        float latencyUs = -1.0f; // < 0 until the first measurement
+        // Interaction box of this device, configured for config version normalizerVersion
+        BoxNormalizer normalizer;
+        uint64_t normalizerVersion = UINT64_MAX;
+    };
+    DeviceState& getDeviceState(const std::string& serialNumber, uint8_t deviceSlot);
+    // Slow path of processData(), taken only while the present hands differ from the reported ones
+    void updatePresence(DeviceState& device, HandPresence current, uint64_t timestamp, const ProcessingConfig& config);
+
+    // Rebuilds device.zeroBundles when the config version changed since they were built
+    void prepareZeroBundles(DeviceState& device, const ProcessingConfig& config);
+    // Sends the hand's zero bundle config.zeroBundleRepeats times
+    void sendZeroValues(const DeviceState& device, size_t hand, const ProcessingConfig& config);
+    // Zeroes every reported hand of a lost device and forgets its presence
+    void resetDevice(DeviceState& device, const ProcessingConfig& config);
+    // Ends what the hand type's outputs were following: releases its gestures
+    // (sent along with `events`) and evicts its state
+    void releaseSlot(DeviceState& device, size_t hand, GestureEvents events, const ProcessingConfig& config);
+    // A hand's state evicted by the table: ends its gestures on its hand type's addresses
+    void releaseEvicted(DeviceState& device, uint32_t key, HandState& state, const ProcessingConfig& config);
     // Helper function for sending OSC messages
-    void sendOscMessage(const std::string& alias, const std::string& handType, const std::string& dataType, const std::string& subType, float value);
+    void sendOscMessage(const std::string& address, float value);
+    // Sends one trigger per event in events, if gesture events are enabled
+    void sendEvents(const DeviceState& device, size_t hand, GestureEvents events, const ProcessingConfig& config);
+    // Lookahead for this frame: the fixed one plus, with toSendTime, the device's measured frame age
+    uint64_t predictionLookaheadUs(DeviceState& device, uint64_t timestamp, const PredictionConfig& prediction);
 
     DeviceAliasManager& aliasManager_;
     OscMessageCallback onOscMessage_;
     UiEventCallback onUiEvent_;
+    OscBundleCallback onOscBundle_;
+    OscMessageCallback onOscEvent_;
+    ClockCallback clock_;
     std::shared_ptr<AppLogger> logger_; 
 
-    // Reverted filter states
-    bool sendPalm_ = true;
-    bool sendWrist_ = true;
-    bool sendThumb_ = true;
-    bool sendIndex_ = true;
-    bool sendMiddle_ = true;
-    bool sendRing_ = true;
-    bool sendPinky_ = true;
-    bool sendPalmOrientation_ = false;
-    bool sendPalmVelocity_ = false;
-    bool sendPalmNormal_ = false;
-    bool sendVisibleTime_ = false;
-    bool sendFingerIsExtended_ = false;
-    // Added pinch/grab filters
-    bool sendPinchStrength_ = true; 
-    bool sendGrabStrength_ = true;  
-
-    // State tracking for zeroing
-    std::map<std::string, std::set<std::string>> lastSeenHandsPerDevice_;
+    // Written by setFieldMask() from the UI thread; read lock-free once per frame
+    AtomicSnapshot<ProcessingConfig> config_;
 
-    // Per-hand state for velocity/gain (by handType: "left"/"right")
-    struct HandMotionState {
-        // Palm
-        Vector3 prevPos_mm; 
-        uint64_t prevTimestamp = 0;
-        Vector3 filteredVelocity = {0,0,0}; 
-        Vector3 cursorNorm = {0.5f, 0.5f, 0.5f}; 
-        Vector3 prevCursorNorm = {0.5f, 0.5f, 0.5f}; 
+    // Per-device addresses and hand presence, keyed by serial number
+    std::map<std::string, DeviceState> devices_;
+    // devices_ entries by FrameData::deviceSlot. Slots are never reused for
+    // another serial, so a filled entry skips the map lookup.
+    std::array<DeviceState*, MAX_TRACKED_DEVICES> slotDevices_{};
+    // Reused for every emitted message so steady-state sends don't allocate
+    OscMessage scratchMessage_;
+    OscMessage skeletonMessage_;
+    OscMessage eventMessage_;
+    // Copy of the hand being sent with its positions smoothed and/or predicted
+    HandData smoothedHand_;
+    // Points and derived values of the hand being sent
+    HandPointPositions points_;
+    DerivedHandData derived_;
+    PoseFeatures poseFeatures_;
 
-        // Wrist
-        Vector3 prevWristPos_mm; 
-        Vector3 wristCursorNorm = {0.5f, 0.5f, 0.5f}; 
-        Vector3 prevWristCursorNorm = {0.5f, 0.5f, 0.5f}; 
-
-        // Finger Tips (Index 0=Thumb, 4=Pinky)
-        Vector3 prevTipPos_mm[5]; 
-        Vector3 tipCursorNorm[5] = {{0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}}; 
-        Vector3 prevTipCursorNorm[5] = {{0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}, {0.5f,0.5f,0.5f}}; 
-    };
-    std::map<std::string, HandMotionState> handMotionStates_; 
 
 };
@@ -0,0 +1,156 @@
+#include "03_FrameWorkerPool.hpp"
+#include <stdexcept>
+#include "../utils/ThreadAffinity.h"
+
+FrameWorkerPool::Worker::Worker(size_t frames, size_t outputs, size_t eventCount)
+    : input(frames, [](FrameData& frame) { frame.hands.reserve(MAX_HANDS_PER_FRAME); })
+    , output(outputs)
+    , events(eventCount)
+{}
+
+FrameWorkerPool::FrameWorkerPool(size_t workerCount,
+                                 LeapSorter& sorter,
+                                 DeviceAliasManager& aliasManager,
+                                 DataProcessor::UiEventCallback onUiEvent,
+                                 std::shared_ptr<AppLogger> logger,
+                                 const std::vector<ThreadPlacement>& placements,
+                                 size_t framesPerWorker,
+                                 size_t outputsPerWorker,
+                                 size_t eventsPerWorker)
+    : sorter_(sorter)
+{
+    if (workerCount < 1 || workerCount > MAX_TRACKED_DEVICES) {
+        throw std::invalid_argument("FrameWorkerPool needs 1 to MAX_TRACKED_DEVICES workers");
+    }
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        auto worker = std::make_unique<Worker>(framesPerWorker, outputsPerWorker, eventsPerWorker);
+        Worker* w = worker.get();
+        if (i < placements.size()) worker->placement = placements[i];
+        worker->processor = std::make_unique<DataProcessor>(
+            aliasManager,
+            [w](const OscMessage& message) { pushOutput(*w, message); },
+            onUiEvent,
+            logger);
+        worker->processor->setOscBundleCallback([w](const OscBundle& bundle) { pushOutput(*w, bundle); });
+        worker->processor->setOscEventCallback([w](const OscMessage& message) { pushEvent(*w, message); });
+        workers_.push_back(std::move(worker));
+    }
+    // Start only once every worker exists, so none can see a half-built pool
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        Worker* w = workers_[i].get();
+        w->thread = std::thread([this, w, i]() { run(*w, i); });
+    }
+    // Wait for the placements, so the reports are complete once constructed
+    for (auto& worker : workers_) {
+        while (!worker->placed.load(std::memory_order_acquire)) std::this_thread::yield();
+    }
+}
+
+FrameWorkerPool::~FrameWorkerPool() {
+    for (auto& worker : workers_) {
+        worker->running.store(false);
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->wake.notify_one();
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) worker->thread.join();
+    }
+}
+
+size_t FrameWorkerPool::workerFor(uint8_t deviceSlot) const {
+    // Frames without a slot all share the first worker, which keeps them in order
+    return deviceSlot == INVALID_DEVICE_SLOT ? 0 : deviceSlot % workers_.size();
+}
+
+bool FrameWorkerPool::submit(const FrameData& frame) {
+    Worker& worker = *workers_[workerFor(frame.deviceSlot)];
+    FrameData* slot = worker.input.acquire();
+    if (!slot) return false;
+    *slot = frame; // Copy-assign: reuses the pooled frame's storage
+    worker.input.publish(slot);
+    ++submittedFrames_;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (worker.sleeping.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.wake.notify_one();
+    }
+    return true;
+}
+
+void FrameWorkerPool::setFieldMask(OscFieldMask fields) {
+    for (auto& worker : workers_) {
+        worker->processor->setFieldMask(fields);
+    }
+}
+
+std::vector<std::string> FrameWorkerPool::getThreadPlacementReports() const {
+    std::vector<std::string> reports;
+    reports.reserve(workers_.size());
+    for (const auto& worker : workers_) reports.push_back(worker->placementReport);
+    return reports;
+}
+
+uint64_t FrameWorkerPool::getProcessedFrames() const {
+    uint64_t processed = 0;
+    for (const auto& worker : workers_) {
+        processed += worker->processed.load(std::memory_order_acquire);
+    }
+    return processed;
+}
+
+template<typename Fill>
+void FrameWorkerPool::pushOutputWith(Worker& worker, Fill&& fill) {
+    // The main loop drains every tick; a full ring only means it is behind.
+    while (!worker.output.try_push_with(fill)) {
+        if (!worker.running.load(std::memory_order_relaxed)) return;
+        std::this_thread::yield();
+    }
+}
+
+void FrameWorkerPool::pushOutput(Worker& worker, const OscMessage& message) {
+    pushOutputWith(worker, [&](Output& slot) {
+        slot.isBundle = false;
+        slot.message.address = message.address;
+        slot.message.values = message.values;
+        slot.message.blob = message.blob;
+    });
+}
+
+void FrameWorkerPool::pushOutput(Worker& worker, const OscBundle& bundle) {
+    pushOutputWith(worker, [&](Output& slot) {
+        slot.isBundle = true;
+        slot.bundle.messages = bundle.messages;
+    });
+}
+
+void FrameWorkerPool::pushEvent(Worker& worker, const OscMessage& message) {
+    while (!worker.events.try_push(message)) {
+        if (!worker.running.load(std::memory_order_relaxed)) return;
+        std::this_thread::yield();
+    }
+}
+
+void FrameWorkerPool::run(Worker& worker, size_t index) {
+    worker.placementReport = ThreadAffinity::applyPlacementToCurrentThread(ThreadNames::frameWorker(index), worker.placement);
+    worker.placed.store(true, std::memory_order_release);
+    for (;;) {
+        if (FrameData* frame = worker.input.receive()) {
+            const HandMask hands = sorter_.selectHands(frame->deviceId, *frame);
+            worker.processor->processData(frame->deviceId, *frame, hands);
+            worker.input.release(frame);
+            worker.processed.fetch_add(1, std::memory_order_release);
+            continue;
+        }
+        if (!worker.running.load()) return;
+
+        std::unique_lock<std::mutex> lock(worker.mutex);
+        worker.sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (worker.input.pending_approx() == 0 && worker.running.load()) {
+            worker.wake.wait(lock);
+        }
+        worker.sleeping.store(false, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "02_LeapSorter.hpp"
+#include "03_DataProcessor.hpp"
+#include "../core/FrameData.hpp"
+#include "../utils/ObjectPool.h"
+#include "../utils/SpscQueue.hpp"
+#include "../utils/ThreadPlacement.h"
+
+// Stage 02+03 sharded by device across a few worker threads. A frame goes to
+// the worker picked by its FrameData::deviceSlot, and that worker runs
+// LeapSorter's hand selection and its own DataProcessor on it. A device only
+// ever maps to one worker, so its DataProcessor state (addresses, hand
+// presence) is owned by that thread alone and needs no locks, and its frames
+// are processed in the order they were submitted.
+//
+// Threading: one thread (the main loop) calls submit(), drain() and flush().
+// Workers write their OSC messages and bundles to their own ring; drain()
+// merges the rings into one sink worker by worker, which keeps each device's
+// output in order. Gesture events have a second, small ring per worker that
+// drain() empties first, so they don't wait behind continuous values. The UI
+// callback runs on the worker threads and must be thread-safe.
+//
+// Worker i is named ThreadNames::frameWorker(i) and placed by placements[i]
+// (default placement past the end) before it takes its first frame.
+class FrameWorkerPool {
+public:
+    FrameWorkerPool(size_t workerCount,
+                    LeapSorter& sorter,
+                    DeviceAliasManager& aliasManager,
+                    DataProcessor::UiEventCallback onUiEvent,
+                    std::shared_ptr<AppLogger> logger,
+                    const std::vector<ThreadPlacement>& placements = {},
+                    size_t framesPerWorker = 64,
+                    size_t outputsPerWorker = 8192,
+                    size_t eventsPerWorker = 256);
+    ~FrameWorkerPool();
+
+    FrameWorkerPool(const FrameWorkerPool&) = delete;
+    FrameWorkerPool& operator=(const FrameWorkerPool&) = delete;
+
+    // Copies the frame to the worker that owns its device. Returns false, with
+    // nothing queued, when that worker already holds framesPerWorker frames;
+    // flush() and submit again.
+    bool submit(const FrameData& frame);
+
+    // Hands everything produced so far to sink.sendOscMessage(const OscMessage&)
+    // and sink.sendOscBundle(const OscBundle&), e.g. an ITransportSink, every
+    // worker's gesture events first. Returns the number of messages and bundles sent.
+    template<typename Sink>
+    size_t drain(Sink& sink) {
+        size_t sent = 0;
+        for (auto& worker : workers_) {
+            while (worker->events.try_pop(scratchEvent_)) {
+                sink.sendOscMessage(scratchEvent_);
+                ++sent;
+            }
+        }
+        for (auto& worker : workers_) {
+            while (worker->output.try_pop(scratchOutput_)) {
+                if (scratchOutput_.isBundle) {
+                    sink.sendOscBundle(scratchOutput_.bundle);
+                } else {
+                    sink.sendOscMessage(scratchOutput_.message);
+                }
+                ++sent;
+            }
+        }
+        return sent;
+    }
+
+    // drain() until every submitted frame has been processed, so a tick's
+    // frames go out in that tick. Returns the number of messages and bundles sent.
+    template<typename Sink>
+    size_t flush(Sink& sink) {
+        size_t sent = drain(sink);
+        while (getProcessedFrames() < submittedFrames_) {
+            std::this_thread::yield();
+            sent += drain(sink);
+        }
+        return sent + drain(sink);
+    }
+
+    // Any thread; forwarded to every worker's DataProcessor.
+    void setFieldMask(OscFieldMask fields);
+
+    // Calls fn(DataProcessor&) for every worker's processor. Only for the
+    // DataProcessor setters, which are safe to call while workers run.
+    template<typename Fn>
+    void forEachProcessor(Fn&& fn) {
+        for (auto& worker : workers_) fn(*worker->processor);
+    }
+
+    size_t workerCount() const { return workers_.size(); }
+    // What placement each worker got, one line per worker, for the startup log.
+    std::vector<std::string> getThreadPlacementReports() const;
+    size_t workerFor(uint8_t deviceSlot) const;
+
+    uint64_t getSubmittedFrames() const { return submittedFrames_; }
+    uint64_t getProcessedFrames() const;
+
+private:
+    // One ring entry. Slots are filled in place and swapped out by drain(), so
+    // both members keep their storage from one trip to the next.
+    struct Output {
+        bool isBundle = false;
+        OscMessage message;
+        OscBundle bundle;
+    };
+
+    struct Worker {
+        Worker(size_t frames, size_t messages, size_t events);
+
+        ObjectPool<FrameData> input;     // main loop -> worker
+        SpscQueue<Output> output;        // worker -> main loop
+        SpscQueue<OscMessage> events;    // worker -> main loop, drained ahead of output
+        std::unique_ptr<DataProcessor> processor;
+        std::atomic<uint64_t> processed{0};
+        ThreadPlacement placement;
+        std::string placementReport; // Written by the worker before it sets placed
+        std::atomic<bool> placed{false};
+        std::atomic<bool> running{true};
+
+        // Parking while idle. The worker sets sleeping before re-checking its
+        // input, and submit() publishes before reading sleeping, with a full
+        // fence on both sides, so one of them always sees the other.
+        std::atomic<bool> sleeping{false};
+        std::mutex mutex;
+        std::condition_variable wake;
+
+        std::thread thread;
+    };
+
+    void run(Worker& worker, size_t index);
+    // DataProcessor callbacks: wait for room rather than drop part of a frame
+    static void pushOutput(Worker& worker, const OscMessage& message);
+    static void pushOutput(Worker& worker, const OscBundle& bundle);
+    static void pushEvent(Worker& worker, const OscMessage& message);
+    template<typename Fill>
+    static void pushOutputWith(Worker& worker, Fill&& fill);
+
+    LeapSorter& sorter_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    uint64_t submittedFrames_ = 0;
+    Output scratchOutput_; // Swapped with ring slots by drain(), so storage is recycled
+    OscMessage scratchEvent_;
+};
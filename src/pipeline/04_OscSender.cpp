@@ -104,7 +104,50 @@ void OscSender::sendMessages(const std::vector<OscMessage>& messages) {
 // Implement ITransportSink methods
 void OscSender::sendOscMessage(const OscMessage& message)
 {
-    sendMessages({message}); // Reuse existing method
+    // Per-frame hot path: encode all values as one message straight into
+    // buffer_, without temporaries or logging, so sending never allocates.
+    if (!socket_ || message.address.empty() || (message.values.empty() && message.blob.empty())) return;
+    try {
+        osc::OutboundPacketStream p(buffer_.data(), buffer_.size());
+        p << osc::BeginMessage(message.address.c_str());
+        for (float value : message.values) {
+            p << value;
+        }
+        if (!message.blob.empty()) {
+            p << osc::Blob(message.blob.data(), static_cast<osc::osc_bundle_element_size_t>(message.blob.size()));
+        }
+        p << osc::EndMessage;
+        socket_->Send(p.Data(), p.Size());
+    } catch (const std::runtime_error& e) {
+        std::cerr << "[OscSender] ERROR sending message to " << message.address << ": " << e.what() << std::endl;
+    }
+}
+
+// One immediate-time bundle in one datagram. A bundle too big for buffer_
+// goes out as separate messages instead.
+void OscSender::sendOscBundle(const OscBundle& bundle)
+{
+    if (!socket_ || bundle.messages.empty()) return;
+    try {
+        osc::OutboundPacketStream p(buffer_.data(), buffer_.size());
+        p << osc::BeginBundleImmediate;
+        for (const OscMessage& message : bundle.messages) {
+            p << osc::BeginMessage(message.address.c_str());
+            for (float value : message.values) {
+                p << value;
+            }
+            if (!message.blob.empty()) {
+                p << osc::Blob(message.blob.data(), static_cast<osc::osc_bundle_element_size_t>(message.blob.size()));
+            }
+            p << osc::EndMessage;
+        }
+        p << osc::EndBundle;
+        socket_->Send(p.Data(), p.Size());
+    } catch (const osc::OutOfBufferMemoryException&) {
+        ITransportSink::sendOscBundle(bundle);
+    } catch (const std::runtime_error& e) {
+        std::cerr << "[OscSender] ERROR sending bundle of " << bundle.messages.size() << " messages: " << e.what() << std::endl;
+    }
 }
 
 void OscSender::updateTarget(const std::string& target, int port)
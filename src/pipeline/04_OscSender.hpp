@@ -25,6 +25,7 @@ public:
     // ITransportSink interface
     bool send(const void* data, size_t size) override; // Send raw bytes (stub for now)
     void sendOscMessage(const OscMessage& message) override;
+    void sendOscBundle(const OscBundle& bundle) override;
     void updateTarget(const std::string& target, int port) override;
     void close() override;
 
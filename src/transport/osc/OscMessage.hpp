@@ -1,8 +1,15 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
 struct OscMessage {
     std::string address;
     std::vector<float> values; // Extend with variant if needed
+    std::vector<uint8_t> blob; // Sent as one blob argument after values, if not empty
+};
+
+// Messages sent as one OSC bundle (one packet), so a receiver applies them together.
+struct OscBundle {
+    std::vector<OscMessage> messages;
 };
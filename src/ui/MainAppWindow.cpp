@@ -1,6 +1,7 @@
 #include "MainAppWindow.h" // Must be first project header
 #include "../core/Log.hpp" // Added include for Log
 #include "../pipeline/03_DataProcessor.hpp"   // brings in DataProcessor + AspectPreset
+#include "../core/HandFeatures.hpp"
 
 // Standard Library Includes
 #include <iostream>     // For std::cerr (may be removed if logger fully replaces)
@@ -528,7 +529,7 @@ void MainAppWindow::renderDevicePanel()
     //---------------------------------------------------------------
     // 2. Render table from the snapshot (no lock held)
     //---------------------------------------------------------------
-    if (!ImGui::BeginTable("DevicesTable", 8, // Adjusted column count
+    if (!ImGui::BeginTable("DevicesTable", 9, // Adjusted column count
         ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY)) {
         return; // Exit if table creation fails
     }
@@ -541,6 +542,7 @@ void MainAppWindow::renderDevicePanel()
     ImGui::TableSetupColumn("Hand Count", ImGuiTableColumnFlags_WidthFixed);
     ImGui::TableSetupColumn("Frame Rate", ImGuiTableColumnFlags_WidthFixed);
     ImGui::TableSetupColumn("Strength", ImGuiTableColumnFlags_WidthFixed);
+    ImGui::TableSetupColumn("Queue Drops / Peak", ImGuiTableColumnFlags_WidthFixed);
     ImGui::TableSetupColumn("Assign Hand", ImGuiTableColumnFlags_WidthFixed);
     ImGui::TableHeadersRow();
 
@@ -570,9 +572,11 @@ void MainAppWindow::renderDevicePanel()
         ImGui::Text("L: P:%.2f G:%.2f", row.deviceData->leftPinchStrength.load(), row.deviceData->leftGrabStrength.load());
         ImGui::SameLine(); 
         ImGui::Text("R: P:%.2f G:%.2f", row.deviceData->rightPinchStrength.load(), row.deviceData->rightGrabStrength.load());
-
-        // --- Hand Assignment Dropdown (Column 7) --- 
         ImGui::TableSetColumnIndex(7);
+        ImGui::Text("%llu / %u", static_cast<unsigned long long>(row.deviceData->queueDropped.load()), row.deviceData->queueHighWater.load());
+
+        // --- Hand Assignment Dropdown (Column 8) --- 
+        ImGui::TableSetColumnIndex(8);
         ImGui::PushID(row.serial.c_str()); // Unique ID per row
         static const char* handOptions[] = { "None", "Left", "Right" };
         int currentHand = 0;
@@ -644,72 +648,71 @@ void MainAppWindow::renderOscSettingsPanel() {
     ImGui::Separator();
     ImGui::Text("OSC Data Filters");
 
-    // Fetch current states using original getter names
-    bool sendPalm = uiController_->isPalmFilterEnabled();
-    bool sendWrist = uiController_->isWristFilterEnabled();
-    bool sendThumb = uiController_->isThumbFilterEnabled();
-    bool sendIndex = uiController_->isIndexFilterEnabled();
-    bool sendMiddle = uiController_->isMiddleFilterEnabled();
-    bool sendRing = uiController_->isRingFilterEnabled();
-    bool sendPinky = uiController_->isPinkyFilterEnabled();
-    // Get states for other original filters if they exist
-    bool sendPalmOrientation = uiController_->isPalmOrientationFilterEnabled();
-    bool sendPalmVelocity = uiController_->isPalmVelocityFilterEnabled();
-    bool sendPalmNormal = uiController_->isPalmNormalFilterEnabled();
-    bool sendVisibleTime = uiController_->isVisibleTimeFilterEnabled();
-    bool sendFingerIsExtended = uiController_->isFingerIsExtendedFilterEnabled();
-    // Get states for pinch/grab filters
-    bool sendPinchStrength = uiController_->isPinchStrengthFilterEnabled();
-    bool sendGrabStrength = uiController_->isGrabStrengthFilterEnabled();
-
-    // Render checkboxes and update UIController on change using setFilterState
-    if (ImGui::Checkbox("Send Palm", &sendPalm)) {
-        uiController_->setFilterState("sendPalm", sendPalm);
-    }
-    if (ImGui::Checkbox("Send Wrist", &sendWrist)) {
-        uiController_->setFilterState("sendWrist", sendWrist);
-    }
-    if (ImGui::Checkbox("Send Thumb", &sendThumb)) {
-        uiController_->setFilterState("sendThumb", sendThumb);
-    }
-    if (ImGui::Checkbox("Send Index Finger", &sendIndex)) {
-        uiController_->setFilterState("sendIndex", sendIndex);
-    }
-    if (ImGui::Checkbox("Send Middle Finger", &sendMiddle)) {
-        uiController_->setFilterState("sendMiddle", sendMiddle);
-    }
-    if (ImGui::Checkbox("Send Ring Finger", &sendRing)) {
-        uiController_->setFilterState("sendRing", sendRing);
-    }
-    if (ImGui::Checkbox("Send Pinky Position", &sendPinky)) {
-        uiController_->setFilterState("sendPinky", sendPinky);
-    }
-    if (ImGui::Checkbox("Send Finger Is Extended", &sendFingerIsExtended)) {
-        uiController_->setFilterState("sendFingerIsExtended", sendFingerIsExtended);
-    }
-    // Add checkboxes for other original filters
-    if (ImGui::Checkbox("Send Palm Orientation", &sendPalmOrientation)) {
-        uiController_->setFilterState("sendPalmOrientation", sendPalmOrientation);
-    }
-    if (ImGui::Checkbox("Send Palm Velocity", &sendPalmVelocity)) {
-        uiController_->setFilterState("sendPalmVelocity", sendPalmVelocity);
+    // One checkbox per registered OSC field
+    for (const OscFieldInfo& info : oscFields()) {
+        bool enabled = uiController_->isFieldEnabled(info.field);
+        if (ImGui::Checkbox(info.label, &enabled)) {
+            uiController_->setFieldEnabled(info.field, enabled);
+        }
     }
-    if (ImGui::Checkbox("Send Palm Normal", &sendPalmNormal)) {
-        uiController_->setFilterState("sendPalmNormal", sendPalmNormal);
+
+    ImGui::Separator();
+    ImGui::Text("Pose Library");
+    ImGui::PushItemWidth(150);
+    ImGui::InputText("Pose Name", poseNameBuffer_, sizeof(poseNameBuffer_));
+    ImGui::PopItemWidth();
+    // Each click records one sample of the named pose from the next frame of that hand
+    const bool waiting = poseRecordHand_.load() >= 0;
+    const bool canRecord = poseNameBuffer_[0] != '\0' && !waiting;
+    if (ImGui::Button("Record Left") && canRecord) poseRecordHand_.store(static_cast<int>(HandType::Left));
+    ImGui::SameLine();
+    if (ImGui::Button("Record Right") && canRecord) poseRecordHand_.store(static_cast<int>(HandType::Right));
+    if (waiting) {
+        ImGui::SameLine();
+        if (ImGui::Button("Cancel")) poseRecordHand_.store(-1);
+        ImGui::SameLine();
+        ImGui::Text("Waiting for the hand...");
+    }
+    std::optional<PoseFeatures> recorded;
+    {
+        std::lock_guard<std::mutex> lock(trackingDataMutex);
+        recorded.swap(recordedPose_);
     }
-    if (ImGui::Checkbox("Send Visible Time", &sendVisibleTime)) {
-        uiController_->setFilterState("sendVisibleTime", sendVisibleTime);
+    if (recorded) {
+        uiController_->recordPoseSample(poseNameBuffer_, *recorded);
+        addStatusMessage(std::string("Recorded a sample of pose '") + poseNameBuffer_ + "'");
     }
-    
-    // Add checkboxes for pinch/grab filters
-    if (ImGui::Checkbox("Send Pinch Strength", &sendPinchStrength)) {
-        uiController_->setFilterState("sendPinchStrength", sendPinchStrength);
+    int removeId = 0;
+    for (const PoseTemplate& pose : uiController_->getPoses()) {
+        ImGui::PushID(pose.id);
+        ImGui::Text("%d: %s (%zu samples)", pose.id, pose.name.c_str(), pose.samples.size());
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Delete")) removeId = pose.id;
+        ImGui::PopID();
     }
-    if (ImGui::Checkbox("Send Grab Strength", &sendGrabStrength)) {
-        uiController_->setFilterState("sendGrabStrength", sendGrabStrength);
+    if (removeId != 0) uiController_->removePose(removeId);
+
+    ImGui::Separator();
+    ImGui::Text("Device Calibration");
+    // Hold one hand where two devices see it and move it around, then solve
+    using CalibrationCommand = UIController::CalibrationCommand;
+    switch (uiController_->getCalibrationState()) {
+        case UIController::CalibrationState::Idle:
+            if (ImGui::Button("Start Calibration")) uiController_->requestCalibration(CalibrationCommand::Start);
+            break;
+        case UIController::CalibrationState::Collecting:
+            if (ImGui::Button("Solve")) uiController_->requestCalibration(CalibrationCommand::Solve);
+            ImGui::SameLine();
+            if (ImGui::Button("Cancel Calibration")) uiController_->requestCalibration(CalibrationCommand::Cancel);
+            break;
+        case UIController::CalibrationState::Solving:
+            ImGui::Text("Solving...");
+            break;
+    }
+    if (!uiController_->getCalibrationStatus().empty()) {
+        ImGui::TextWrapped("%s", uiController_->getCalibrationStatus().c_str());
     }
 
-    // --- REMOVED Pinch/Grab Checkboxes --- -> Re-added above
     // --- REMOVED Session Duration Display and Reset Button --- 
 
     ImGui::EndChild();
@@ -758,6 +761,11 @@ std::vector<std::string> MainAppWindow::getStatusMessages() {
 // Implementation was previously added
 MainAppWindow::PerDeviceTrackingData& MainAppWindow::getDeviceData(const std::string& serialNumber) {
     // Lock should be acquired by the CALLER before calling this function
+    // Look up first: emplace() would allocate a node on every call, and this runs per frame.
+    auto existing = deviceTrackingDataMap.find(serialNumber);
+    if (existing != deviceTrackingDataMap.end()) {
+        return existing->second;
+    }
     auto [it, inserted] = deviceTrackingDataMap.emplace(
         std::piecewise_construct,
         std::forward_as_tuple(serialNumber),
@@ -778,9 +786,7 @@ const MainAppWindow::PerDeviceTrackingData& MainAppWindow::getDeviceData(const s
 }
 
 // Event handlers - UPDATED implementation signature and logic
-void MainAppWindow::handleTrackingData(const FrameData& frame) {
-    if (logger_) logger_("MainAppWindow::handleTrackingData received frame");
-
+void MainAppWindow::handleTrackingData(const FrameData& frame, HandMask hands) {
     std::lock_guard<std::mutex> lock(trackingDataMutex); 
     MainAppWindow::PerDeviceTrackingData& data = getDeviceData(frame.deviceId); 
 
@@ -797,23 +803,39 @@ void MainAppWindow::handleTrackingData(const FrameData& frame) {
     data.lastFrameTime = now;
     data.frameCount++;
 
-    data.handCount.store(static_cast<int>(frame.hands.size()));
-
     // Reset pinch/grab before updating
+    int handCount = 0;
     float lPinch = 0.0f, lGrab = 0.0f, rPinch = 0.0f, rGrab = 0.0f;
-    for (const auto& hand : frame.hands) {
-        if (hand.handType == "left") {
+    for (size_t i = 0; i < frame.hands.size(); ++i) {
+        if (!(hands & handBit(i))) continue;
+        const HandData& hand = frame.hands[i];
+        ++handCount;
+        if (hand.handType == HandType::Left) {
             lPinch = hand.pinchStrength;
             lGrab = hand.grabStrength;
-        } else if (hand.handType == "right") {
+        } else {
             rPinch = hand.pinchStrength;
             rGrab = hand.grabStrength;
         }
     }
+    data.handCount.store(handCount);
     data.leftPinchStrength.store(lPinch);
     data.leftGrabStrength.store(lGrab);
     data.rightPinchStrength.store(rPinch);
     data.rightGrabStrength.store(rGrab);
+
+    const int recordHand = poseRecordHand_.load();
+    if (recordHand < 0) return;
+    for (size_t i = 0; i < frame.hands.size(); ++i) {
+        if (!(hands & handBit(i)) || static_cast<int>(frame.hands[i].handType) != recordHand) continue;
+        DerivedHandData features;
+        computeHandFeatures(frame.hands[i], features);
+        PoseFeatures sample;
+        buildPoseFeatures(frame.hands[i], features, sample);
+        recordedPose_ = sample;
+        poseRecordHand_.store(-1);
+        break;
+    }
 }
 
 void MainAppWindow::handleConnect(const ConnectEvent& event) {
@@ -840,6 +862,13 @@ void MainAppWindow::handleDeviceConnected(const DeviceConnectedEvent& event) {
     addStatusMessage(postLockMessage);
 }
 
+void MainAppWindow::handleQueueStats(const std::string& serialNumber, uint64_t dropped, uint32_t highWater) {
+    std::lock_guard<std::mutex> lock(trackingDataMutex);
+    PerDeviceTrackingData& data = getDeviceData(serialNumber);
+    data.queueDropped.store(dropped);
+    data.queueHighWater.store(highWater);
+}
+
 void MainAppWindow::handleDeviceLost(const DeviceLostEvent& event) {
     std::string message = "Device lost: SN " + event.serialNumber;
     addStatusMessage(message);
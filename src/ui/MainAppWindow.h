@@ -22,6 +22,7 @@
 // Event type includes - Use FrameData instead of TrackingDataEvent
 // #include "../core/TrackingDataEvent.hpp" // REMOVED
 #include "../core/FrameData.hpp"           // ADDED (If not already present)
+#include "../core/PoseClassifier.hpp"
 #include "../core/ConnectEvent.hpp"
 #include "UIController.hpp" // Needed for interactions
 #include "json.hpp" // Ensure json is included here
@@ -77,6 +78,8 @@ public:
         std::atomic<float> leftGrabStrength = { 0.0f };
         std::atomic<float> rightPinchStrength = { 0.0f };
         std::atomic<float> rightGrabStrength = { 0.0f };
+        std::atomic<uint64_t> queueDropped = { 0 };   // Frames dropped between poll thread and main loop
+        std::atomic<uint32_t> queueHighWater = { 0 }; // Most of this device's frames ever waiting at once
     };
     /**
      * Must be called before first render() to ensure dataProcessor is valid.
@@ -140,12 +143,15 @@ public:
     void renderMainUI();
 
     // Event handlers - UPDATED handleTrackingData signature
-    void handleTrackingData(const FrameData& frame);
+    // hands: the frame's hands assigned to this device (see LeapSorter); others are ignored.
+    void handleTrackingData(const FrameData& frame, HandMask hands = ALL_HANDS);
     void handleConnect(const ConnectEvent& event);
     void handleDisconnect(const DisconnectEvent& event);
     void handleDeviceConnected(const DeviceConnectedEvent& event);
     void handleDeviceLost(const DeviceLostEvent& event);
     void handleDeviceHandAssigned(const DeviceHandAssignedEvent& event);
+    // Periodic frame queue counters for one device (see AppCore::publishQueueStats)
+    void handleQueueStats(const std::string& serialNumber, uint64_t dropped, uint32_t highWater);
 
     // Dependency-injected event callbacks - UPDATED onTrackingData type
     std::function<void(const FrameData&)> onTrackingData;
@@ -189,6 +195,12 @@ private:
     std::map<std::string, PerDeviceTrackingData> deviceTrackingDataMap;
     std::mutex trackingDataMutex;
 
+    // Pose recording: a Record button sets the hand to capture, and the next
+    // tracking frame that has that hand stores its features for render().
+    char poseNameBuffer_[32] = "";
+    std::atomic<int> poseRecordHand_ = { -1 };  // HandType to capture, -1 = none
+    std::optional<PoseFeatures> recordedPose_;  // Guarded by trackingDataMutex
+
     // Connection Status
     std::atomic<bool> isLeapConnected = {false};
 
@@ -23,15 +23,15 @@ public:
 public:
     // Define callback types for clarity (Reverted)
     using HandAssignmentCommand = std::function<void(const std::string& serial, const std::string& hand)>;
-    // Reverted ConfigUpdateCommand signature (12 bools) -> Updated to 14 bools
-    using ConfigUpdateCommand = std::function<void(
-        bool /*palm*/, bool /*wrist*/, 
-        bool /*thumb*/, bool /*index*/, bool /*middle*/, bool /*ring*/, bool /*pinky*/,
-        bool /*palmOrientation*/, bool /*palmVelocity*/, bool /*palmNormal*/,
-        bool /*visibleTime*/, bool /*fingerIsExtended*/,
-        bool /*pinchStrength*/, bool /*grabStrength*/ // Added pinch/grab
-    )>;
+    // Receives the complete set of enabled OSC fields whenever one changes
+    using ConfigUpdateCommand = std::function<void(OscFieldMask fields)>;
     using OscSettingsUpdateCallback = std::function<void(const std::string& /*newIp*/, int /*newPort*/)>;
+    // Receives the pose library whenever it changes
+    using PoseLibraryUpdateCallback = std::function<void(const std::vector<PoseTemplate>& poses)>;
+    // Extrinsic calibration between devices, carried out by AppCore
+    enum class CalibrationCommand { Start, Solve, Cancel };
+    enum class CalibrationState { Idle, Collecting, Solving };
+    using CalibrationCallback = std::function<void(CalibrationCommand command)>;
 
     // Constructor - Updated to accept shared_ptr<AppLogger>
     UIController(LeapSorter& leapSorter, IConfigStore& configStore, std::shared_ptr<AppLogger> logger);
@@ -40,6 +40,8 @@ public:
     void setHandAssignmentCallback(HandAssignmentCommand callback);
     void setConfigUpdateCallback(ConfigUpdateCommand callback); 
     void setOscSettingsUpdateCallback(OscSettingsUpdateCallback callback);
+    void setPoseLibraryUpdateCallback(PoseLibraryUpdateCallback callback);
+    void setCalibrationCallback(CalibrationCallback callback);
 
     // Hand assignment methods
     void setDeviceHandAssignment(const std::string& serial, const std::string& hand);
@@ -47,29 +49,31 @@ public:
     std::vector<HandAssignmentEvent>& getHandAssignmentQueue() { return handAssignmentQueue_; }
     std::mutex& getEventQueueMutex() { return eventQueueMutex_; }
 
-    // Getters for filter states (used by MainAppWindow) - Reverted
-    bool isPalmFilterEnabled() const;
-    bool isWristFilterEnabled() const;
-    bool isThumbFilterEnabled() const;
-    bool isIndexFilterEnabled() const;
-    bool isMiddleFilterEnabled() const;
-    bool isRingFilterEnabled() const;
-    bool isPinkyFilterEnabled() const;
-    bool isPalmOrientationFilterEnabled() const;
-    bool isPalmVelocityFilterEnabled() const;
-    bool isPalmNormalFilterEnabled() const;
-    bool isVisibleTimeFilterEnabled() const;
-    bool isFingerIsExtendedFilterEnabled() const;
-    // Added getters for pinch/grab
-    bool isPinchStrengthFilterEnabled() const;
-    bool isGrabStrengthFilterEnabled() const;
-
-    // Method to update individual filter settings (called by MainAppWindow)
-    void setFilterState(const std::string& filterName, bool enabled);
+    // OSC field (filter) state, used by MainAppWindow
+    bool isFieldEnabled(OscField field) const { return (fieldMask_ & oscFieldBit(field)) != 0; }
+    OscFieldMask getFieldMask() const { return fieldMask_; }
+
+    // Updates one field, persists it and notifies AppCore (called by MainAppWindow)
+    void setFieldEnabled(OscField field, bool enabled);
 
     // Method to initialize filters from ConfigManager
     void initializeAllFilters();
 
+    // Pose library, used by MainAppWindow. Recording adds a sample to the pose
+    // with that name (a new pose gets the next free id); both persist the
+    // library and notify AppCore. getPoses() is read every UI frame, so it
+    // returns a cached copy, refreshed only when these change the library.
+    const std::vector<PoseTemplate>& getPoses();
+    void recordPoseSample(const std::string& name, const PoseFeatures& sample);
+    void removePose(int id);
+
+    // Calibration, used by MainAppWindow; AppCore reports progress and
+    // residuals back through setCalibrationState().
+    void requestCalibration(CalibrationCommand command);
+    void setCalibrationState(CalibrationState state, const std::string& status);
+    CalibrationState getCalibrationState() const { return calibrationState_; }
+    const std::string& getCalibrationStatus() const { return calibrationStatus_; }
+
     // OSC Destination Settings methods
     void initializeOscSettings(const std::string& initialIp, int initialPort);
     void applyOscSettings(); 
@@ -93,31 +97,26 @@ private:
     HandAssignmentCommand handAssignmentCommand_;
     ConfigUpdateCommand configUpdateCommand_;
     OscSettingsUpdateCallback onOscSettingsUpdate_;
+    PoseLibraryUpdateCallback onPoseLibraryUpdate_;
+    CalibrationCallback onCalibrationCommand_;
+
+    // Pose library as last read from the config store
+    std::vector<PoseTemplate> poses_;
+    bool posesLoaded_ = false;
+    void updatePoses(std::vector<PoseTemplate> poses);
     // REMOVED resetSessionTimerCallback_
     // REMOVED filterSettingsChangedCallback_
 
-    // Internal state for OSC filters (Reverted)
-    bool sendPalm_ = true;
-    bool sendWrist_ = true;
-    bool sendThumb_ = true;
-    bool sendIndex_ = true;
-    bool sendMiddle_ = true;
-    bool sendRing_ = true;
-    bool sendPinky_ = true;
-    bool sendPalmOrientation_ = false; // Added back old filters
-    bool sendPalmVelocity_ = false;
-    bool sendPalmNormal_ = false;
-    bool sendVisibleTime_ = false;
-    bool sendFingerIsExtended_ = false;
-    // REMOVED sendPinchStrength_ -> ADDED sendPinchStrength_
-    // REMOVED sendGrabStrength_ -> ADDED sendGrabStrength_
-    bool sendPinchStrength_ = true; // Added back, default true
-    bool sendGrabStrength_ = true;  // Added back, default true
+    // Internal state for OSC filters
+    OscFieldMask fieldMask_ = defaultOscFieldMask();
 
     // Internal state for OSC destination editing
     char oscIpBuffer_[OSC_IP_BUFFER_SIZE] = {0}; 
     int oscPort_ = 0; 
 
+    CalibrationState calibrationState_ = CalibrationState::Idle;
+    std::string calibrationStatus_;
+
     // References to core components
     LeapSorter& leapSorter_;             // Reference to the sorter
     IConfigStore& configManager_;       // Now using config interface
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// Read-mostly value published RCU-style: readers get a shared pointer to an
+// immutable version with a single atomic load, writers copy the current
+// version, modify the copy and swap it in.
+//
+// A version lives as long as the snapshot or a reader still holds it, so a
+// reader may keep using what it loaded for as long as it likes, and replaced
+// versions are freed as soon as the last reader lets go of them. Loading
+// neither locks a writer out nor allocates.
+template<typename T>
+class AtomicSnapshot {
+public:
+    AtomicSnapshot() : AtomicSnapshot(T{}) {}
+
+    explicit AtomicSnapshot(T initial)
+        : current_(std::make_shared<const T>(std::move(initial))) {}
+
+    AtomicSnapshot(const AtomicSnapshot&) = delete;
+    AtomicSnapshot& operator=(const AtomicSnapshot&) = delete;
+
+    // Any thread. Never null. Hold on to the result for as long as the
+    // version is used; a reference into a temporary can outlive it.
+    std::shared_ptr<const T> load() const noexcept {
+        return std::atomic_load(&current_);
+    }
+
+    // Publishes a modified copy of the current version. Writers are serialised.
+    template<typename Fn>
+    void update(Fn&& modify) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        auto next = std::make_shared<T>(*std::atomic_load(&current_));
+        modify(*next);
+        std::atomic_store(&current_, std::shared_ptr<const T>(std::move(next)));
+    }
+
+private:
+    std::shared_ptr<const T> current_;
+    std::mutex writeMutex_;
+};
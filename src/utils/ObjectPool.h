@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <new>
+
+#include "SpscQueue.hpp"
+
+// Fixed set of preallocated objects handed between one producer and one
+// consumer thread. Objects travel as pointers over two rings:
+//
+//   producer: acquire() -> fill -> publish()   ==ready==>  consumer: receive()
+//   producer: acquire() <==free==  release() <- done with it <- consumer
+//
+// Nothing is constructed or destroyed after startup, so members such as
+// vectors keep their capacity from one trip to the next and the two threads
+// never trade heap blocks. Copy-assign into an acquired object to reuse it.
+//
+// The ready ring uses monotonically increasing indices and a CAS on the read
+// index, so besides the consumer the producer may also take back the oldest
+// unreceived object (reclaimOldest()) to overwrite it when the pool runs dry.
+template<typename T>
+class ObjectPool {
+    static constexpr size_t cache_line_size = std::hardware_destructive_interference_size;
+
+public:
+    explicit ObjectPool(size_t capacity)
+        : ObjectPool(capacity, [](T&) {}) {}
+
+    // init is called once per pooled object, e.g. to reserve capacity up front.
+    template<typename Init>
+    ObjectPool(size_t capacity, Init init)
+        : objects_(capacity)
+        , free_(capacity)
+        , ready_(new std::atomic<T*>[capacity])
+    {
+        if (capacity < 1) {
+            throw std::invalid_argument("ObjectPool capacity must be at least 1");
+        }
+        // Threads are not running yet, so filling the free ring from here is safe.
+        for (size_t i = 0; i < capacity; ++i) {
+            ready_[i].store(nullptr, std::memory_order_relaxed);
+            init(objects_[i]);
+            free_.try_push(&objects_[i]);
+        }
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // --- Producer side ---
+
+    // Takes an unused object, or nullptr when every object is in flight
+    // (the consumer is behind; the caller drops its data or reclaims).
+    T* acquire() noexcept {
+        T* object = nullptr;
+        free_.try_pop(object);
+        return object;
+    }
+
+    // Hands a filled object to the consumer. Cannot fail: the ready ring is
+    // as large as the pool.
+    void publish(T* object) noexcept {
+        const uint64_t tail = readyTail_.load(std::memory_order_relaxed);
+        ready_[tail % objects_.size()].store(object, std::memory_order_relaxed);
+        readyTail_.store(tail + 1, std::memory_order_release);
+    }
+
+    // Takes back the oldest published object the consumer has not received
+    // yet, or nullptr if there is none. The caller owns it again.
+    T* reclaimOldest() noexcept {
+        return takeOldest(readyTail_.load(std::memory_order_relaxed));
+    }
+
+    // --- Consumer side ---
+
+    // Next published object in order, or nullptr when none is pending.
+    T* receive() noexcept {
+        return takeOldest(readyTail_.load(std::memory_order_acquire));
+    }
+
+    // Returns a received object to the producer for reuse.
+    void release(T* object) noexcept {
+        free_.try_push(std::move(object));
+    }
+
+    size_t capacity() const noexcept { return objects_.size(); }
+
+    // Approximate number of objects published but not yet received.
+    size_t pending_approx() const noexcept {
+        const uint64_t head = readyHead_.load(std::memory_order_relaxed);
+        const uint64_t tail = readyTail_.load(std::memory_order_relaxed);
+        return tail > head ? static_cast<size_t>(tail - head) : 0;
+    }
+
+private:
+    T* takeOldest(uint64_t tail) noexcept {
+        uint64_t head = readyHead_.load(std::memory_order_acquire);
+        while (head < tail) {
+            T* object = ready_[head % objects_.size()].load(std::memory_order_acquire);
+            // Whoever advances the read index owns the object; a failed CAS
+            // means the other side took it first, so look at the next one.
+            if (readyHead_.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return object;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<T> objects_;  // Never resized after construction, so pointers stay valid
+    SpscQueue<T*> free_;      // consumer -> producer
+    std::unique_ptr<std::atomic<T*>[]> ready_; // producer -> consumer, indexed by sequence % capacity
+    alignas(cache_line_size) std::atomic<uint64_t> readyHead_{0}; // Advanced by receive() and reclaimOldest()
+    alignas(cache_line_size) std::atomic<uint64_t> readyTail_{0}; // Advanced by publish() only
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Single-writer sequence lock around a trivially copyable value.
+//
+// The writer never blocks or waits on readers: it bumps the sequence to odd,
+// copies the value in, and bumps it back to even. Readers copy the value out
+// and retry if the sequence was odd or changed underneath them, so they always
+// return a snapshot from exactly one write. Suits small, frequently
+// overwritten "latest value" cells where readers are rare compared to writes.
+template<typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock<T> requires a trivially copyable T");
+
+public:
+    SeqLock() = default;
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    // Writer only. Must not be called from more than one thread.
+    void store(const T& value) noexcept {
+        const uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&value_, &value, sizeof(T));
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    // Any thread. Returns false if nothing has been stored yet.
+    bool load(T& out) const noexcept {
+        for (;;) {
+            const uint32_t before = seq_.load(std::memory_order_acquire);
+            if (before == 0) return false;
+            if (before & 1u) continue; // Write in progress
+            std::memcpy(&out, &value_, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq_.load(std::memory_order_relaxed) == before) return true;
+        }
+    }
+
+    // Number of completed stores; cheap change detection for pollers.
+    uint32_t version() const noexcept {
+        return seq_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    std::atomic<uint32_t> seq_{0};
+    T value_{};
+};
@@ -3,6 +3,7 @@
 #include <vector>
 #include <atomic>
 #include <optional>
+#include <utility>   // For std::swap
 #include <stdexcept> // For std::runtime_error
 #include <new>       // For std::hardware_destructive_interference_size
 
@@ -53,11 +54,39 @@ public:
     }
 
      // Attempts to push an item into the queue (producer only).
-     // Uses copy semantics.
+     // Copy-assigns into the slot, so a slot that already owns storage
+     // (see try_pop(T&)) reuses it instead of allocating.
      // Returns true if successful, false if the queue is full.
     bool try_push(const T& item) noexcept {
-        T temp = item; // Create a temporary copy
-        return try_push(std::move(temp)); // Use move push
+        const size_t current_tail = tail_.load(std::memory_order_relaxed);
+        const size_t next_tail = (current_tail + 1) % capacity_;
+
+        if (next_tail == head_.load(std::memory_order_acquire)) {
+            return false; // Queue is full
+        }
+
+        buffer_[current_tail] = item;
+
+        tail_.store(next_tail, std::memory_order_release);
+        return true;
+    }
+
+    // Fills the next free slot in place with fill(T&) (producer only), for
+    // element types where building a T just to copy it in would be wasteful.
+    // Returns false, without calling fill, if the queue is full.
+    template<typename Fill>
+    bool try_push_with(Fill&& fill) {
+        const size_t current_tail = tail_.load(std::memory_order_relaxed);
+        const size_t next_tail = (current_tail + 1) % capacity_;
+
+        if (next_tail == head_.load(std::memory_order_acquire)) {
+            return false; // Queue is full
+        }
+
+        fill(buffer_[current_tail]);
+
+        tail_.store(next_tail, std::memory_order_release);
+        return true;
     }
 
     // Attempts to pop an item from the queue (consumer only).
@@ -81,6 +110,26 @@ public:
         return item; // Return the retrieved item by value (moved)
     }
 
+    // Attempts to pop an item into an existing object (consumer only).
+    // The slot and `out` are swapped rather than moved, so the storage the
+    // consumer is done with goes back into the ring for the producer to
+    // overwrite. With copy pushes this keeps steady-state traffic allocation-free.
+    // Returns false if the queue is empty.
+    bool try_pop(T& out) noexcept {
+        const size_t current_head = head_.load(std::memory_order_relaxed);
+
+        if (current_head == tail_.load(std::memory_order_acquire)) {
+            return false; // Queue is empty
+        }
+
+        using std::swap;
+        swap(out, buffer_[current_head]);
+
+        const size_t next_head = (current_head + 1) % capacity_;
+        head_.store(next_head, std::memory_order_release);
+        return true;
+    }
+
     // Checks if the queue is empty (consumer perspective).
     bool empty() const noexcept {
         return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
@@ -1,50 +1,149 @@
 #pragma once
 
 #include <thread>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "ThreadPlacement.h"
 
 #ifdef _WIN32
 #include <Windows.h>
 #else
 #include <pthread.h>
+#include <sched.h>
 #endif
 
 /**
  * Utility functions for managing thread affinity.
- * 
+ *
  * These functions allow pinning threads to specific CPU cores to reduce
  * context switching and improve cache locality.
  */
 class ThreadAffinity {
 public:
+#ifdef _WIN32
+    using NativeHandle = HANDLE;
+#else
+    using NativeHandle = pthread_t;
+#endif
+
     /**
      * Sets thread affinity to a specific core.
-     * 
+     *
      * @param thread The thread to set affinity for
      * @param coreIndex The zero-based index of the core to pin the thread to
      * @return True if successful, false otherwise
      */
     static bool pinThreadToCore(std::thread& thread, int coreIndex) {
+        return pinToCore(thread.native_handle(), coreIndex);
+    }
+
+    /**
+     * Sets the OS-visible name of a thread (shown in debuggers, top -H, etc.).
+     * Linux truncates names to 15 characters.
+     */
+    static bool setThreadName(std::thread& thread, const std::string& name) {
+        return setName(thread.native_handle(), name);
+    }
+
+    /**
+     * Applies a scheduling policy/priority to a thread.
+     * On Linux, SCHED_FIFO/SCHED_RR usually need CAP_SYS_NICE or an rtprio limit.
+     */
+    static bool setThreadPriority(std::thread& thread, ThreadSchedPolicy policy, int priority) {
+        return setPriority(thread.native_handle(), policy, priority);
+    }
+
+    /**
+     * Applies name, core pinning and scheduling policy to a thread.
+     *
+     * @return A one-line human readable report of what was applied, for the startup log.
+     */
+    static std::string applyPlacement(std::thread& thread, const std::string& name, const ThreadPlacement& placement) {
+        return apply(thread.native_handle(), name, placement);
+    }
+
+    // Same as applyPlacement(), for the calling thread (used for the UI/main thread).
+    static std::string applyPlacementToCurrentThread(const std::string& name, const ThreadPlacement& placement) {
+#ifdef _WIN32
+        return apply(GetCurrentThread(), name, placement);
+#else
+        return apply(pthread_self(), name, placement);
+#endif
+    }
+
+    /**
+     * Gets the number of available CPU cores.
+     *
+     * @return The number of CPU cores
+     */
+    static int getProcessorCount() {
+        return std::thread::hardware_concurrency();
+    }
+
+private:
+    static bool pinToCore(NativeHandle handle, int coreIndex) {
+        if (coreIndex < 0 || coreIndex >= getProcessorCount()) return false;
 #ifdef _WIN32
         // Windows implementation
         DWORD_PTR mask = 1ULL << coreIndex;
-        DWORD_PTR result = SetThreadAffinityMask(thread.native_handle(), mask);
+        DWORD_PTR result = SetThreadAffinityMask(handle, mask);
         return result != 0;
 #else
         // Linux/Unix implementation
         cpu_set_t cpuSet;
         CPU_ZERO(&cpuSet);
         CPU_SET(coreIndex, &cpuSet);
-        int result = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+        int result = pthread_setaffinity_np(handle, sizeof(cpu_set_t), &cpuSet);
         return result == 0;
 #endif
     }
 
-    /**
-     * Gets the number of available CPU cores.
-     * 
-     * @return The number of CPU cores
-     */
-    static int getProcessorCount() {
-        return std::thread::hardware_concurrency();
+    static bool setName(NativeHandle handle, const std::string& name) {
+#ifdef _WIN32
+        std::wstring wideName(name.begin(), name.end());
+        return SUCCEEDED(SetThreadDescription(handle, wideName.c_str()));
+#else
+        return pthread_setname_np(handle, name.substr(0, 15).c_str()) == 0;
+#endif
+    }
+
+    static bool setPriority(NativeHandle handle, ThreadSchedPolicy policy, int priority) {
+        if (policy == ThreadSchedPolicy::Default) return true;
+#ifdef _WIN32
+        // No real-time scheduling classes per thread on Windows; map the
+        // requested priority onto the closest Win32 thread priority level.
+        int level = THREAD_PRIORITY_ABOVE_NORMAL;
+        if (priority >= 90) level = THREAD_PRIORITY_TIME_CRITICAL;
+        else if (priority >= 50) level = THREAD_PRIORITY_HIGHEST;
+        return SetThreadPriority(handle, level) != 0;
+#else
+        int osPolicy = policy == ThreadSchedPolicy::Fifo ? SCHED_FIFO : SCHED_RR;
+        sched_param param{};
+        param.sched_priority = std::max(sched_get_priority_min(osPolicy),
+                                        std::min(priority, sched_get_priority_max(osPolicy)));
+        return pthread_setschedparam(handle, osPolicy, &param) == 0;
+#endif
+    }
+
+    static std::string apply(NativeHandle handle, const std::string& name, const ThreadPlacement& placement) {
+        std::ostringstream report;
+        report << name << ": name " << (setName(handle, name) ? "set" : "FAILED");
+
+        if (placement.coreIndex >= 0) {
+            report << ", core " << placement.coreIndex << " "
+                   << (pinToCore(handle, placement.coreIndex) ? "pinned" : "FAILED");
+        } else {
+            report << ", unpinned";
+        }
+
+        if (placement.policy != ThreadSchedPolicy::Default) {
+            report << ", " << threadSchedPolicyToString(placement.policy) << "/" << placement.priority << " "
+                   << (setPriority(handle, placement.policy, placement.priority) ? "applied" : "FAILED");
+        } else {
+            report << ", default scheduling";
+        }
+        return report.str();
     }
-}; 
\ No newline at end of file
+};
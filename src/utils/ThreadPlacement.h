@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <algorithm>
+#include <cctype>
+
+// Names of the app's internal threads. They double as the keys of the
+// "thread_placement" section in config.json. OSC has no thread of its own:
+// it is sent from the main loop.
+namespace ThreadNames {
+    constexpr const char* LeapPoll = "leap-poll"; // LeapInput::pollThread_
+    constexpr const char* Ui = "ui";              // main/UI loop thread
+    constexpr const char* Calibration = "calibration"; // ExtrinsicCalibrator::worker_, while solving
+
+    // FrameWorkerPool's workers: "frame-worker-0", "frame-worker-1", ...
+    inline std::string frameWorker(size_t index) { return "frame-worker-" + std::to_string(index); }
+}
+
+// Scheduling policy requested for a thread.
+// Fifo/RoundRobin map to SCHED_FIFO/SCHED_RR on Linux. Windows has no
+// equivalent, so both are mapped onto the Win32 thread priority levels.
+enum class ThreadSchedPolicy {
+    Default,
+    Fifo,
+    RoundRobin
+};
+
+// Desired placement for one internal thread. The default-constructed value
+// means "leave the thread alone", so unconfigured threads keep OS defaults.
+struct ThreadPlacement {
+    int coreIndex = -1;                                   // -1 = not pinned
+    ThreadSchedPolicy policy = ThreadSchedPolicy::Default;
+    int priority = 0;                                     // 1-99 for Fifo/RoundRobin
+
+    bool isDefault() const {
+        return coreIndex < 0 && policy == ThreadSchedPolicy::Default;
+    }
+};
+
+inline const char* threadSchedPolicyToString(ThreadSchedPolicy policy) {
+    switch (policy) {
+        case ThreadSchedPolicy::Fifo:       return "fifo";
+        case ThreadSchedPolicy::RoundRobin: return "rr";
+        default:                            return "default";
+    }
+}
+
+inline ThreadSchedPolicy threadSchedPolicyFromString(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (value == "fifo" || value == "sched_fifo") return ThreadSchedPolicy::Fifo;
+    if (value == "rr" || value == "sched_rr" || value == "round_robin") return ThreadSchedPolicy::RoundRobin;
+    return ThreadSchedPolicy::Default;
+}
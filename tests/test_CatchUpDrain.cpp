@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "../src/core/CatchUpDrain.hpp"
+#include <vector>
+
+namespace {
+FrameData makeFrame(const std::string& deviceId, uint64_t timestamp, bool left, bool right) {
+    FrameData frame;
+    frame.deviceId = deviceId;
+    frame.timestamp = timestamp;
+    if (left) { frame.hands.emplace_back(); frame.hands.back().handType = HandType::Left; }
+    if (right) { frame.hands.emplace_back(); frame.hands.back().handType = HandType::Right; }
+    return frame;
+}
+
+std::vector<uint64_t> drainTimestamps(CatchUpDrain& drain, FrameChannel& channel) {
+    std::vector<uint64_t> timestamps;
+    drain.drain(channel, [&](const FrameData& frame) { timestamps.push_back(frame.timestamp); });
+    return timestamps;
+}
+}
+
+TEST(CatchUpDrainTest, ProcessesEverythingBelowThreshold) {
+    FrameChannel channel(64);
+    CatchUpDrain drain(64);
+    drain.setThreshold(8);
+    for (uint64_t t = 1; t <= 8; ++t) channel.publish(makeFrame("A", t, true, false));
+    EXPECT_EQ(drainTimestamps(drain, channel), (std::vector<uint64_t>{1, 2, 3, 4, 5, 6, 7, 8}));
+    EXPECT_EQ(drain.getSkippedCount(), 0u);
+}
+
+TEST(CatchUpDrainTest, KeepsOnlyNewestFramePerDeviceWhenBehind) {
+    FrameChannel channel(64);
+    CatchUpDrain drain(64);
+    drain.setThreshold(4);
+    for (uint64_t t = 1; t <= 10; ++t) {
+        channel.publish(makeFrame("A", t, true, false));
+        channel.publish(makeFrame("B", 100 + t, false, true));
+    }
+    // First frame of each device is a transition from "no hands"; then only the newest
+    EXPECT_EQ(drainTimestamps(drain, channel), (std::vector<uint64_t>{1, 101, 10, 110}));
+    EXPECT_EQ(drain.getSkippedCount(), 16u);
+}
+
+TEST(CatchUpDrainTest, PreservesHandLossAndReturnTransitions) {
+    FrameChannel channel(64);
+    CatchUpDrain drain(64);
+    drain.setThreshold(2);
+
+    // Establish "both hands visible" as the last processed state
+    channel.publish(makeFrame("A", 1, true, true));
+    drainTimestamps(drain, channel);
+
+    channel.publish(makeFrame("A", 2, true, true));
+    channel.publish(makeFrame("A", 3, true, false)); // Right hand lost
+    channel.publish(makeFrame("A", 4, true, false));
+    channel.publish(makeFrame("A", 5, true, true));  // Right hand back
+    channel.publish(makeFrame("A", 6, true, true));
+    channel.publish(makeFrame("A", 7, true, true));
+    EXPECT_EQ(drainTimestamps(drain, channel), (std::vector<uint64_t>{3, 5, 7}));
+    EXPECT_EQ(drain.getSkippedCount(), 3u);
+}
+
+TEST(CatchUpDrainTest, ZeroThresholdDisablesCatchUp) {
+    FrameChannel channel(64);
+    CatchUpDrain drain(64);
+    drain.setThreshold(0);
+    for (uint64_t t = 1; t <= 40; ++t) channel.publish(makeFrame("A", t, true, false));
+    EXPECT_EQ(drainTimestamps(drain, channel).size(), 40u);
+    EXPECT_EQ(drain.getSkippedCount(), 0u);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "../src/core/ConfigManager.h"
+#include "../src/core/FrameData.hpp"
 #include <fstream>
 #include <cstdio>
 
@@ -15,7 +16,7 @@ TEST(ConfigManagerTest, SaveAndLoadConfig) {
 
     // Save to temp file
     std::string filename = "test_config.json";
-    ASSERT_TRUE(config.saveConfig(filename));
+    ASSERT_TRUE(config.save(filename));
     
     // Make a new config and load
     ConfigManager loaded;
@@ -38,3 +39,205 @@ TEST(ConfigManagerTest, HandlesMissingFile) {
     // Should return false for missing file
     ASSERT_FALSE(config.loadConfig("nonexistent_file.json"));
 }
+
+TEST(ConfigManagerTest, ThreadPlacementRoundTrip) {
+    ConfigManager config;
+    ThreadPlacement poll;
+    poll.coreIndex = 2;
+    poll.policy = ThreadSchedPolicy::Fifo;
+    poll.priority = 80;
+    config.setThreadPlacement(ThreadNames::LeapPoll, poll);
+
+    std::string filename = "test_thread_placement.json";
+    ASSERT_TRUE(config.save(filename));
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    ThreadPlacement loadedPoll = loaded.getThreadPlacement(ThreadNames::LeapPoll);
+    EXPECT_EQ(loadedPoll.coreIndex, 2);
+    EXPECT_EQ(loadedPoll.policy, ThreadSchedPolicy::Fifo);
+    EXPECT_EQ(loadedPoll.priority, 80);
+    // Threads without an entry keep OS defaults
+    EXPECT_TRUE(loaded.getThreadPlacement(ThreadNames::Ui).isDefault());
+
+    std::remove(filename.c_str());
+}
+
+TEST(ConfigManagerTest, FrameQueueSettingsRoundTrip) {
+    ConfigManager config;
+    EXPECT_EQ(config.getFrameQueueOverflowPolicy(), FrameOverflowPolicy::DropNewest);
+    config.setFrameQueueOverflowPolicy(FrameOverflowPolicy::CoalesceLatest);
+    config.setQueueStatsIntervalMs(250);
+    EXPECT_EQ(config.getProcessingWorkers(), 0);
+    config.setProcessingWorkers(100);
+    EXPECT_EQ(config.getProcessingWorkers(), static_cast<int>(MAX_TRACKED_DEVICES));
+    config.setProcessingWorkers(3);
+    EXPECT_EQ(config.getHandLossHoldFrames(), 3);
+    config.setHandLossHoldFrames(5);
+    config.setHandLossHoldMs(40);
+
+    std::string filename = "test_frame_queue.json";
+    ASSERT_TRUE(config.save(filename));
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    EXPECT_EQ(loaded.getFrameQueueOverflowPolicy(), FrameOverflowPolicy::CoalesceLatest);
+    EXPECT_EQ(loaded.getQueueStatsIntervalMs(), 250);
+    EXPECT_EQ(loaded.getProcessingWorkers(), 3);
+    EXPECT_EQ(loaded.getHandLossHoldFrames(), 5);
+    EXPECT_EQ(loaded.getHandLossHoldMs(), 40);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ConfigManagerTest, OscFieldsRoundTripAsBooleanSettings) {
+    ConfigManager config;
+    EXPECT_EQ(config.getOscFieldMask(), defaultOscFieldMask());
+    const OscFieldMask fields = oscFieldBit(OscField::Wrist) | oscFieldBit(OscField::PalmNormal);
+    config.setOscFieldMask(fields);
+
+    std::string filename = "test_osc_fields.json";
+    ASSERT_TRUE(config.save(filename));
+
+    // Stored under the existing per-field keys
+    std::ifstream ifs(filename);
+    nlohmann::json j;
+    ifs >> j;
+    ifs.close();
+    EXPECT_FALSE(j["booleanSettings"]["sendPalm"].get<bool>());
+    EXPECT_TRUE(j["booleanSettings"]["sendWrist"].get<bool>());
+    EXPECT_TRUE(j["booleanSettings"]["sendPalmNormal"].get<bool>());
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    EXPECT_EQ(loaded.getOscFieldMask(), fields);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ConfigManagerTest, SmoothingRoundTripPerGroup) {
+    ConfigManager config;
+    EXPECT_FALSE(config.getSmoothing().anyEnabled());
+    SmoothingConfig smoothing;
+    smoothing[SmoothingGroup::Fingers].enabled = true;
+    smoothing[SmoothingGroup::Fingers].minCutoff = 0.5f;
+    smoothing[SmoothingGroup::Fingers].beta = 0.02f;
+    smoothing[SmoothingGroup::Palm].dCutoff = -1.0f; // Clamped to a usable cutoff
+    config.setSmoothing(smoothing);
+
+    std::string filename = "test_smoothing.json";
+    ASSERT_TRUE(config.save(filename));
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    const SmoothingConfig result = loaded.getSmoothing();
+    EXPECT_TRUE(result[SmoothingGroup::Fingers].enabled);
+    EXPECT_FLOAT_EQ(result[SmoothingGroup::Fingers].minCutoff, 0.5f);
+    EXPECT_FLOAT_EQ(result[SmoothingGroup::Fingers].beta, 0.02f);
+    EXPECT_FALSE(result[SmoothingGroup::Palm].enabled);
+    EXPECT_GT(result[SmoothingGroup::Palm].dCutoff, 0.0f);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ConfigManagerTest, GainCurveRoundTrip) {
+    ConfigManager config;
+    GainCurve curve;
+    curve.baseGain = 0.5f;
+    curve.maxGain = 8.0f;
+    curve.midSpeed = 300.0f;
+    curve.velocitySource = GainVelocitySource::Points;
+    config.setGainCurve(curve);
+    EXPECT_FLOAT_EQ(config.getMaxGain(), 8.0f); // Same values as the gain params
+
+    std::string filename = "test_gain_curve.json";
+    ASSERT_TRUE(config.save(filename));
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    const GainCurve result = loaded.getGainCurve();
+    EXPECT_FLOAT_EQ(result.baseGain, 0.5f);
+    EXPECT_FLOAT_EQ(result.midGain, 3.0f);
+    EXPECT_FLOAT_EQ(result.maxGain, 8.0f);
+    EXPECT_FLOAT_EQ(result.midSpeed, 300.0f);
+    EXPECT_EQ(result.velocitySource, GainVelocitySource::Points);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ConfigManagerTest, NormalizedOutputRoundTrip) {
+    ConfigManager config;
+    EXPECT_EQ(config.getPositionOutput(), PositionOutput::Raw);
+    config.setPositionOutput(PositionOutput::Both);
+    config.setLearnInteractionBoxes(true);
+    config.setInteractionBox("LPM1", InteractionBox{ {-100.0f, 50.0f, -80.0f}, {100.0f, 350.0f, 80.0f} });
+    config.setInteractionBox("LPM2", InteractionBox{ {0.0f, 0.0f, 0.0f}, {0.0f, 10.0f, 10.0f} }); // Empty x: ignored
+
+    std::string filename = "test_normalized_output.json";
+    ASSERT_TRUE(config.save(filename));
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    EXPECT_EQ(loaded.getPositionOutput(), PositionOutput::Both);
+    EXPECT_TRUE(loaded.getLearnInteractionBoxes());
+    const auto boxes = loaded.getInteractionBoxes();
+    ASSERT_EQ(boxes.size(), 1u);
+    EXPECT_FLOAT_EQ(boxes.at("LPM1").min.y, 50.0f);
+    EXPECT_FLOAT_EQ(boxes.at("LPM1").max.z, 80.0f);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ConfigManagerTest, PoseLibraryRoundTrip) {
+    ConfigManager config;
+    PoseTemplate fist{ 1, "fist", {} };
+    PoseFeatures sample;
+    for (size_t i = 0; i < POSE_FEATURES_USED; ++i) sample.values[i] = 0.01f * static_cast<float>(i);
+    fist.samples = { sample, sample };
+    config.setPoses({ fist, PoseTemplate{ 0, "unnumbered", {} }, PoseTemplate{ 1, "duplicate", {} } });
+    config.setPoseMatch(PoseMatchConfig{ 0.25f, 0.3f });
+
+    std::string filename = "test_pose_library.json";
+    ASSERT_TRUE(config.save(filename));
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    const auto poses = loaded.getPoses();
+    ASSERT_EQ(poses.size(), 1u); // Id 0 and the duplicate id are dropped
+    EXPECT_EQ(poses[0].name, "fist");
+    ASSERT_EQ(poses[0].samples.size(), 2u);
+    EXPECT_FLOAT_EQ(poses[0].samples[1].values[27], 0.27f);
+    EXPECT_FLOAT_EQ(poses[0].samples[1].values[28], 0.0f); // Padding is not saved
+    EXPECT_FLOAT_EQ(loaded.getPoseMatch().maxDistance, 0.25f);
+    EXPECT_FLOAT_EQ(loaded.getPoseMatch().minMargin, 0.3f);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ConfigManagerTest, FusionAndExtrinsicsRoundTrip) {
+    ConfigManager config;
+    FusionConfig fusion;
+    fusion.enabled = true;
+    fusion.associationRadiusMm = 60.0f;
+    fusion.maxAgeMs = 30;
+    config.setFusion(fusion);
+    RigidTransform transform;
+    transform.rotation = { 0, 0, 1, 0, 1, 0, -1, 0, 0 };
+    transform.translation = { 250.0f, 0.0f, -40.0f };
+    config.setDeviceExtrinsic("LPM2", transform);
+
+    std::string filename = "test_fusion.json";
+    ASSERT_TRUE(config.save(filename));
+
+    ConfigManager loaded;
+    ASSERT_TRUE(loaded.loadConfig(filename));
+    const FusionConfig restored = loaded.getFusion();
+    EXPECT_TRUE(restored.enabled);
+    EXPECT_FLOAT_EQ(restored.associationRadiusMm, 60.0f);
+    EXPECT_EQ(restored.maxAgeMs, 30u);
+    ASSERT_EQ(restored.extrinsics.count("LPM2"), 1u);
+    EXPECT_EQ(restored.extrinsics.at("LPM2").rotation, transform.rotation);
+    EXPECT_FLOAT_EQ(restored.extrinsics.at("LPM2").translation.z, -40.0f);
+
+    std::remove(filename.c_str());
+}
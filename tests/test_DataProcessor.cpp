@@ -11,26 +11,22 @@
 HandData makeHand(const std::string& side) {
     std::cout << "[DEBUG] makeHand called for side=" << side << std::endl << std::flush;
     HandData h;
-    h.handType = side;
+    h.handType = side == "left" ? HandType::Left : HandType::Right;
     h.palm.position = {1.0f, 2.0f, 3.0f};
     h.valid = true;           // Ensure hand is valid
     h.arm.wristPosition = {4.0f, 5.0f, 6.0f};
     h.arm.valid = true;       // Ensure arm is valid
-    h.fingers.clear();
     for (int i = 0; i < 5; ++i) {
-        FingerData f;
+        FingerData& f = h.fingers[i];
         f.fingerId = i;
         f.isExtended = true;
         f.valid = true;       // Ensure finger is valid
-        f.bones.clear();
         for (int b = 0; b < 4; ++b) {
-            BoneData bone;
+            BoneData& bone = f.bones[b];
             bone.prevJoint = {static_cast<float>(7+b), static_cast<float>(8+b), static_cast<float>(9+b)};
             bone.nextJoint = {static_cast<float>(10+b), static_cast<float>(11+b), static_cast<float>(12+b)};
             bone.valid = true; // Ensure bone is valid
-            f.bones.push_back(bone);
         }
-        h.fingers.push_back(f);
     }
     return h;
 }
@@ -49,15 +45,9 @@ TEST(DataProcessorConfigTest, MappingAffectOSC) {
     DataProcessor proc(aliasMgr, [&](const OscMessage& msg) {
         std::cout << "[DEBUG][OSC CALLBACK] Received OSC address: " << msg.address << std::endl << std::flush;
         oscAddresses.push_back(msg.address);
-    }, [](const FrameData&) {}, nullptr);
-    proc.setFilterSettings(true, true, true, true, true, true, true, false, false, false, false, false, false, false); // Enable all fingers, palm, wrist
-    std::cout << "[DEBUG][TEST] Filter flags: sendPalm_=" << proc.sendPalm_
-              << ", sendWrist_=" << proc.sendWrist_
-              << ", sendThumb_=" << proc.sendThumb_
-              << ", sendIndex_=" << proc.sendIndex_
-              << ", sendMiddle_=" << proc.sendMiddle_
-              << ", sendRing_=" << proc.sendRing_
-              << ", sendPinky_=" << proc.sendPinky_ << std::endl << std::flush;
+    }, [](const FrameData&, HandMask) {}, nullptr);
+    proc.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::Wrist) | oscFieldBit(OscField::Thumb) | oscFieldBit(OscField::Index) | oscFieldBit(OscField::Middle) | oscFieldBit(OscField::Ring) | oscFieldBit(OscField::Pinky)); // Enable all fingers, palm, wrist
+    std::cout << "[DEBUG][TEST] Field mask: " << proc.getFieldMask() << std::endl << std::flush;
     FrameData frame;
     frame.deviceId = "serialA";
     HandData hand = makeHand("left");
@@ -67,7 +57,7 @@ TEST(DataProcessorConfigTest, MappingAffectOSC) {
     std::cout << "[DEBUG][TEST] frame.hands.size()=" << frame.hands.size() << std::endl << std::flush;
     if (!frame.hands.empty()) {
         const auto& hand = frame.hands[0];
-        std::cout << "[DEBUG][TEST] handType=" << hand.handType
+        std::cout << "[DEBUG][TEST] handType=" << handTypeName(hand.handType)
                   << ", hand.valid=" << hand.valid
                   << ", hand.isValid()=" << hand.isValid()
                   << ", arm.valid=" << hand.arm.valid
@@ -127,28 +117,13 @@ TEST(DataProcessorTest, SendsPalmAndWristMessages) {
     DataProcessor proc(aliasMgr, [&](const OscMessage& msg) {
         std::cout << "[DEBUG][OSC CALLBACK] Received OSC address: " << msg.address << std::endl << std::flush;
         oscAddresses.push_back(msg.address);
-    }, [](const FrameData&) {}, nullptr);
+    }, [](const FrameData&, HandMask) {}, nullptr);
     // Only palm and wrist
-    proc.setFilterSettings(
-        true,  // palm
-        true,  // wrist
-        false,  // thumb
-        false,  // index
-        false,  // middle
-        false,  // ring
-        false,  // pinky
-        false,  // palm orientation
-        false,  // palm velocity
-        false,  // palm normal
-        false,  // visible time
-        false,  // is extended
-        false,  // pinch
-        false   // grab
-    );
+    proc.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::Wrist));
     FrameData frame;
     frame.deviceId = "serialA";
     frame.hands.push_back(makeHand("left"));
-    std::cout << "[TEST] SendsPalmAndWristMessages: hand type: " << frame.hands[0].handType << ", fingers size: " << frame.hands[0].fingers.size() << std::endl << std::flush;
+    std::cout << "[TEST] SendsPalmAndWristMessages: hand type: " << handTypeName(frame.hands[0].handType) << ", fingers size: " << frame.hands[0].fingers.size() << std::endl << std::flush;
     for (size_t i = 0; i < frame.hands[0].fingers.size(); ++i) {
         std::cout << "[DEBUG] Finger " << i << ": valid=" << frame.hands[0].fingers[i].isValid()
                   << " bones=" << frame.hands[0].fingers[i].bones.size() << std::endl << std::flush;
@@ -197,28 +172,13 @@ TEST(DataProcessorTest, FingerFiltersWork) {
         std::cout << "Callback called: " << msg.address << std::endl << std::flush;
         std::cout << "[DEBUG][OSC CALLBACK] Received OSC address: " << msg.address << std::endl << std::flush;
         oscAddresses.push_back(msg.address);
-    }, [](const FrameData&) {}, logger2);
+    }, [](const FrameData&, HandMask) {}, logger2);
     // Only thumb
-    proc.setFilterSettings(
-        false,  // palm
-        false,  // wrist
-        true,   // thumb
-        false,  // index
-        false,  // middle
-        false,  // ring
-        false,  // pinky
-        false,  // palm orientation
-        false,  // palm velocity
-        false,  // palm normal
-        false,  // visible time
-        false,  // is extended
-        false,  // pinch
-        false   // grab
-    );
+    proc.setFieldMask(oscFieldBit(OscField::Thumb));
     FrameData frame;
     frame.deviceId = "serialA";
     frame.hands.push_back(makeHand("right"));
-    std::cout << "[TEST] FingerFiltersWork: hand type: " << frame.hands[0].handType << ", fingers size: " << frame.hands[0].fingers.size() << std::endl << std::flush;
+    std::cout << "[TEST] FingerFiltersWork: hand type: " << handTypeName(frame.hands[0].handType) << ", fingers size: " << frame.hands[0].fingers.size() << std::endl << std::flush;
     for (size_t i = 0; i < frame.hands[0].fingers.size(); ++i) {
         std::cout << "[DEBUG] Finger " << i << ": valid=" << frame.hands[0].fingers[i].isValid()
                   << " bones=" << frame.hands[0].fingers[i].bones.size() << std::endl << std::flush;
@@ -258,7 +218,7 @@ TEST(DataProcessorTest, MinimalTest) {
     FrameData frame;
     frame.deviceId = "serialA";
     frame.hands.push_back(makeHand("right"));
-    std::cout << "[TEST] MinimalTest: hand type: " << frame.hands[0].handType << ", fingers size: " << frame.hands[0].fingers.size() << std::endl << std::flush;
+    std::cout << "[TEST] MinimalTest: hand type: " << handTypeName(frame.hands[0].handType) << ", fingers size: " << frame.hands[0].fingers.size() << std::endl << std::flush;
     for (size_t i = 0; i < frame.hands[0].fingers.size(); ++i) {
         std::cout << "[DEBUG] Finger " << i << ": valid=" << frame.hands[0].fingers[i].isValid()
                   << " bones=" << frame.hands[0].fingers[i].bones.size() << std::endl << std::flush;
@@ -271,24 +231,9 @@ TEST(DataProcessorTest, MinimalTest) {
         callbackCalled = true;
         std::cout << "[DEBUG][OSC CALLBACK] Received OSC address: " << msg.address << std::endl << std::flush;
         oscAddresses.push_back(msg.address);
-    }, [](const FrameData&) {}, logger3);
+    }, [](const FrameData&, HandMask) {}, logger3);
     // Only thumb enabled
-    proc2.setFilterSettings(
-        false,  // palm
-        false,  // wrist
-        true,   // thumb
-        false,  // index
-        false,  // middle
-        false,  // ring
-        false,  // pinky
-        false,  // palm orientation
-        false,  // palm velocity
-        false,  // palm normal
-        false,  // visible time
-        false,  // is extended
-        false,  // pinch
-        false   // grab
-    );
+    proc2.setFieldMask(oscFieldBit(OscField::Thumb));
     proc2.processData("serialA", frame);
     // Print all OSC addresses for debugging
     std::cout << "[TEST] All OSC addresses (MinimalTest):" << std::endl << std::flush;
@@ -313,8 +258,8 @@ TEST(DataProcessorTest, NoMessagesIfNothingEnabled) {
     DataProcessor proc(aliasMgr, [&](const OscMessage& msg) {
         std::cout << "[DEBUG][OSC CALLBACK] Received OSC address: " << msg.address << std::endl << std::flush;
         oscAddresses.push_back(msg.address);
-    }, [](const FrameData&) {}, nullptr);
-    proc.setFilterSettings(false, false, false, false, false, false, false, false, false, false, false, false, false, false); // All off
+    }, [](const FrameData&, HandMask) {}, nullptr);
+    proc.setFieldMask(0); // All off
 
     FrameData frame;
     frame.deviceId = "serialA";
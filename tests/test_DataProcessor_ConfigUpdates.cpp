@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/FrameData.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include "../src/utils/AtomicSnapshot.h"
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace {
+FrameData makeFrame() {
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.hands.resize(1);
+    frame.hands[0].handType = HandType::Left;
+    frame.hands[0].palm.position = {1.0f, 2.0f, 3.0f};
+    return frame;
+}
+
+// Counts live copies, to see which versions a snapshot still holds
+struct Counted {
+    static int live;
+    int value = 0;
+    Counted() { ++live; }
+    Counted(const Counted& other) : value(other.value) { ++live; }
+    ~Counted() { --live; }
+};
+int Counted::live = 0;
+}
+
+TEST(DataProcessorConfigUpdatesTest, NewFieldMaskAppliesFromNextFrame) {
+    DeviceAliasManager aliasMgr;
+    size_t messages = 0;
+    DataProcessor proc(aliasMgr, [&](const OscMessage&) { ++messages; }, nullptr, nullptr);
+    EXPECT_EQ(proc.getConfigVersion(), 0u);
+
+    proc.setFieldMask(oscFieldBit(OscField::Palm));
+    EXPECT_EQ(proc.getConfigVersion(), 1u);
+    EXPECT_EQ(proc.getFieldMask(), oscFieldBit(OscField::Palm));
+    proc.processData("serialA", makeFrame());
+    EXPECT_EQ(messages, 3u);
+
+    messages = 0;
+    proc.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::PalmNormal));
+    EXPECT_EQ(proc.getConfigVersion(), 2u);
+    proc.processData("serialA", makeFrame());
+    EXPECT_EQ(messages, 6u);
+}
+
+// Filter changes arrive from the UI thread while frames are processed; every
+// frame must be emitted entirely under one field set or the other.
+TEST(DataProcessorConfigUpdatesTest, FramesNeverSeeHalfAppliedFilters) {
+    const OscFieldMask palmOnly = oscFieldBit(OscField::Palm);                      // 3 values
+    const OscFieldMask wristPinchGrab = oscFieldBit(OscField::Wrist) |
+        oscFieldBit(OscField::PinchStrength) | oscFieldBit(OscField::GrabStrength); // 5 values
+
+    DeviceAliasManager aliasMgr;
+    size_t palmMessages = 0, otherMessages = 0;
+    bool consistent = true;
+    size_t frames = 0;
+    DataProcessor proc(
+        aliasMgr,
+        [&](const OscMessage& msg) {
+            if (msg.address.find("/palm/") != std::string::npos) ++palmMessages; else ++otherMessages;
+        },
+        [&](const FrameData&, HandMask) {
+            const bool palmFrame = palmMessages == 3 && otherMessages == 0;
+            const bool otherFrame = palmMessages == 0 && otherMessages == 5;
+            if (!palmFrame && !otherFrame) consistent = false;
+            palmMessages = otherMessages = 0;
+            ++frames;
+        },
+        nullptr);
+    proc.setFieldMask(palmOnly);
+
+    std::atomic<bool> done{false};
+    std::thread ui([&]() {
+        for (int i = 0; i < 2000; ++i) proc.setFieldMask(i % 2 ? palmOnly : wristPinchGrab);
+        done = true;
+    });
+    const FrameData frame = makeFrame();
+    while (!done) proc.processData("serialA", frame);
+    ui.join();
+
+    EXPECT_GT(frames, 0u);
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(proc.getConfigVersion(), 2001u);
+}
+
+// Every setter publishes a full config copy; replaced versions must be freed,
+// not piled up for the life of the processor.
+TEST(DataProcessorConfigUpdatesTest, ReplacedVersionsAreReleased) {
+    {
+        AtomicSnapshot<Counted> snapshot;
+        std::shared_ptr<const Counted> held = snapshot.load(); // A reader mid-frame
+        for (int i = 0; i < 1000; ++i) {
+            snapshot.update([&](Counted& next) { next.value = i; });
+        }
+        EXPECT_EQ(snapshot.load()->value, 999);
+        EXPECT_EQ(held->value, 0);     // Still valid for its reader
+        EXPECT_EQ(Counted::live, 2);   // That one and the current one
+        held.reset();
+        EXPECT_EQ(Counted::live, 1);
+    }
+    EXPECT_EQ(Counted::live, 0);
+
+    DeviceAliasManager aliasMgr;
+    DataProcessor proc(aliasMgr, [](const OscMessage&) {}, nullptr, nullptr);
+    auto library = std::make_shared<const PoseLibrary>(std::vector<PoseTemplate>());
+    proc.setPoses(library, PoseMatchConfig());
+    for (int i = 0; i < 1000; ++i) {
+        proc.setFieldMask(i % 2 ? oscFieldBit(OscField::Palm) : defaultOscFieldMask());
+    }
+    proc.processData("serialA", makeFrame());
+    EXPECT_EQ(library.use_count(), 2); // Ours and the current version's: the 1000 before it are gone
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/FrameData.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+class HandLossHoldTest : public ::testing::Test {
+protected:
+    DeviceAliasManager aliasMgr;
+    size_t zeros = 0; // Messages to the left hand's palm/tx that carried 0
+    DataProcessor proc{aliasMgr, [this](const OscMessage& msg) {
+        if (msg.address == "/leap/dev1/left/palm/tx" && msg.values[0] == 0.f) ++zeros;
+    }, nullptr, nullptr};
+
+    void SetUp() override { proc.setFieldMask(oscFieldBit(OscField::Palm)); }
+
+    void frame(bool leftPresent, uint64_t timestampUs = 0) {
+        FrameData f;
+        f.deviceId = "serialA";
+        f.deviceSlot = 0;
+        f.timestamp = timestampUs;
+        if (leftPresent) {
+            f.hands.resize(1);
+            f.hands[0].handType = HandType::Left;
+            f.hands[0].palm.position = {1.0f, 2.0f, 3.0f};
+        }
+        proc.processData(f.deviceId, f);
+    }
+};
+}
+
+TEST_F(HandLossHoldTest, ZeroesImmediatelyWithoutHold) {
+    frame(true);
+    frame(false);
+    EXPECT_EQ(zeros, 1u);
+    frame(false); // Already zeroed, not repeated
+    EXPECT_EQ(zeros, 1u);
+}
+
+TEST_F(HandLossHoldTest, HoldsForConfiguredFrames) {
+    proc.setHandLossHold(2, 0);
+    frame(true);
+    frame(false);
+    frame(false);
+    EXPECT_EQ(zeros, 0u);
+    frame(false); // Third missing frame: past the hold
+    EXPECT_EQ(zeros, 1u);
+}
+
+TEST_F(HandLossHoldTest, ReturningHandRestartsTheHold) {
+    proc.setHandLossHold(2, 0);
+    frame(true);
+    frame(false);
+    frame(false);
+    frame(true); // Brief dropout: no zeros
+    frame(false);
+    frame(false);
+    EXPECT_EQ(zeros, 0u);
+    frame(false);
+    EXPECT_EQ(zeros, 1u);
+}
+
+TEST_F(HandLossHoldTest, HoldsForConfiguredTime) {
+    proc.setHandLossHold(0, 50);
+    frame(true, 1'000'000);
+    frame(false, 1'010'000);
+    frame(false, 1'040'000);
+    EXPECT_EQ(zeros, 0u);
+    frame(false, 1'060'000); // 50 ms after the first missing frame
+    EXPECT_EQ(zeros, 1u);
+}
+
+TEST_F(HandLossHoldTest, FramesOrTimeWhicheverComesFirst) {
+    proc.setHandLossHold(100, 20);
+    frame(true, 0);
+    frame(false, 1'000);
+    frame(false, 25'000);
+    EXPECT_EQ(zeros, 1u);
+}
+
+TEST_F(HandLossHoldTest, ZeroesGoOutAsOneBundlePerHand) {
+    std::vector<OscBundle> bundles;
+    proc.setOscBundleCallback([&](const OscBundle& bundle) { bundles.push_back(bundle); });
+    proc.setZeroBundleRepeats(3);
+    frame(true);
+    frame(false);
+    ASSERT_EQ(bundles.size(), 3u);
+    ASSERT_EQ(bundles[0].messages.size(), 3u); // palm/tx, ty, tz
+    EXPECT_EQ(bundles[0].messages[0].address, "/leap/dev1/left/palm/tx");
+    EXPECT_EQ(bundles[0].messages[0].values, std::vector<float>{0.f});
+    EXPECT_EQ(zeros, 0u); // Nothing went through the per-message callback
+}
+
+TEST_F(HandLossHoldTest, DeviceLossZeroesHeldAndPresentHands) {
+    proc.setHandLossHold(10, 0);
+    frame(true);
+    frame(false); // Held, not zeroed yet
+    EXPECT_EQ(zeros, 0u);
+
+    FrameData lost;
+    lost.deviceId = "serialA";
+    lost.deviceSlot = 0;
+    lost.deviceLost = true;
+    proc.processData(lost.deviceId, lost);
+    EXPECT_EQ(zeros, 1u);
+    proc.processData(lost.deviceId, lost); // Nothing left to zero
+    EXPECT_EQ(zeros, 1u);
+}
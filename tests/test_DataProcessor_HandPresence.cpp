@@ -8,25 +8,21 @@
 // Utility: Create a valid hand for testing
 HandData makeHand(const std::string& side) {
     HandData h;
-    h.handType = side;
+    h.handType = side == "left" ? HandType::Left : HandType::Right;
     h.palm.position = {1.0f, 2.0f, 3.0f};
     h.arm.wristPosition = {4.0f, 5.0f, 6.0f};
     h.arm.setValid(true);
-    h.fingers.clear();
     for (int i = 0; i < 5; ++i) {
-        FingerData f;
+        FingerData& f = h.fingers[i];
         f.fingerId = i;
         f.isExtended = true;
         f.setValid(true);
-        f.bones.clear();
         for (int b = 0; b < 4; ++b) {
-            BoneData bone;
+            BoneData& bone = f.bones[b];
             bone.prevJoint = {static_cast<float>(7+b), static_cast<float>(8+b), static_cast<float>(9+b)};
             bone.nextJoint = {static_cast<float>(10+b), static_cast<float>(11+b), static_cast<float>(12+b)};
             bone.setValid(true);
-            f.bones.push_back(bone);
         }
-        h.fingers.push_back(f);
     }
     return h;
 }
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "../src/core/ExtrinsicCalibration.hpp"
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+// 30 degrees about z, then 40 degrees about y, and a translation
+RigidTransform truth() {
+    const float a = 0.52359878f, b = 0.69813170f;
+    RigidTransform z, y;
+    z.rotation = { std::cos(a), -std::sin(a), 0, std::sin(a), std::cos(a), 0, 0, 0, 1 };
+    y.rotation = { std::cos(b), 0, std::sin(b), 0, 1, 0, -std::sin(b), 0, std::cos(b) };
+    RigidTransform t = compose(y, z);
+    t.translation = { 250.0f, -30.0f, 80.0f };
+    return t;
+}
+
+// Device-space points spread through a 300 mm cube, deterministically
+std::vector<PointPair> pairsFor(const RigidTransform& transform, size_t count) {
+    std::vector<PointPair> pairs;
+    for (size_t i = 0; i < count; ++i) {
+        const Vector3 p{ std::fmod(i * 37.0f, 300.0f) - 150.0f, 100.0f + std::fmod(i * 53.0f, 300.0f),
+                         std::fmod(i * 71.0f, 300.0f) - 150.0f };
+        pairs.push_back({ transform.applyToPoint(p), p });
+    }
+    return pairs;
+}
+
+void expectNear(const RigidTransform& actual, const RigidTransform& expected, float rotationTolerance, float mm) {
+    for (size_t i = 0; i < 9; ++i) EXPECT_NEAR(actual.rotation[i], expected.rotation[i], rotationTolerance) << i;
+    EXPECT_NEAR(actual.translation.x, expected.translation.x, mm);
+    EXPECT_NEAR(actual.translation.y, expected.translation.y, mm);
+    EXPECT_NEAR(actual.translation.z, expected.translation.z, mm);
+}
+
+FrameData frame(const std::string& device, uint8_t slot, uint64_t timestampUs, const RigidTransform& toDevice,
+                Vector3 palm) {
+    FrameData f;
+    f.deviceId = device;
+    f.deviceSlot = slot;
+    f.timestamp = timestampUs;
+    f.hands.resize(1);
+    HandData& hand = f.hands[0];
+    hand.palm.position = toDevice.applyToPoint(palm);
+    for (size_t i = 0; i < 5; ++i) {
+        const Vector3 tip{ palm.x + (static_cast<float>(i) - 2.0f) * 20.0f, palm.y + 10.0f * i, palm.z - 80.0f };
+        hand.fingers[i].bones[3].nextJoint = toDevice.applyToPoint(tip);
+    }
+    return f;
+}
+
+// Inverse of a rigid transform: the rotation transposed
+RigidTransform inverse(const RigidTransform& t) {
+    RigidTransform inv;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) inv.rotation[i * 3 + j] = t.rotation[j * 3 + i];
+    }
+    const Vector3 back = inv.applyToDirection(t.translation);
+    inv.translation = { -back.x, -back.y, -back.z };
+    return inv;
+}
+}
+
+TEST(ExtrinsicCalibration, KabschRecoversAnExactTransform) {
+    const auto pairs = pairsFor(truth(), 20);
+    RigidTransform solved;
+    ASSERT_TRUE(solveRigidTransform(pairs.data(), pairs.size(), solved));
+    expectNear(solved, truth(), 1e-4f, 0.05f);
+}
+
+TEST(ExtrinsicCalibration, KabschRejectsCollinearPoints) {
+    std::vector<PointPair> pairs;
+    for (int i = 0; i < 5; ++i) pairs.push_back({ { i * 10.0f, 0, 0 }, { 0, i * 10.0f, 0 } });
+    RigidTransform solved;
+    EXPECT_FALSE(solveRigidTransform(pairs.data(), pairs.size(), solved));
+}
+
+TEST(ExtrinsicCalibration, RansacIgnoresOutliers) {
+    auto pairs = pairsFor(truth(), 120);
+    for (size_t i = 0; i < pairs.size(); i += 5) pairs[i].reference.x += 200.0f; // A fifth are mismatched
+    const CalibrationResult result = solveRigidTransformRansac(pairs, CalibrationConfig());
+    ASSERT_TRUE(result.solved);
+    EXPECT_EQ(result.pairs, 120u);
+    EXPECT_EQ(result.inliers, 96u);
+    EXPECT_LT(result.rmsErrorMm, 0.1f);
+    expectNear(result.transform, truth(), 1e-4f, 0.1f);
+}
+
+TEST(ExtrinsicCalibration, CalibratorPairsSimultaneousFramesAndSolvesInTheBackground) {
+    // Device B sees the room through truth(): its coordinates map onto A's by truth()
+    const RigidTransform toB = inverse(truth());
+    ExtrinsicCalibrator calibrator;
+    calibrator.start();
+    uint64_t t = 1'000'000;
+    for (int i = 0; i < 40; ++i, t += 20'000) {
+        const Vector3 palm{ std::fmod(i * 37.0f, 300.0f) - 150.0f, 150.0f + std::fmod(i * 53.0f, 200.0f),
+                            std::fmod(i * 71.0f, 300.0f) - 150.0f };
+        calibrator.addFrame(frame("A", 0, t, RigidTransform(), palm));
+        calibrator.addFrame(frame("B", 1, t + 1'000, toB, palm));
+        calibrator.addFrame(frame("B", 1, t + 8'000, toB, palm)); // Too far from A's frame
+    }
+    EXPECT_EQ(calibrator.referenceSerial(), "A");
+    EXPECT_EQ(calibrator.sampleCounts().at("B"), 40u);
+
+    ASSERT_TRUE(calibrator.solve());
+    EXPECT_FALSE(calibrator.isCollecting());
+    std::vector<CalibrationResult> results;
+    for (int wait = 0; wait < 500 && !calibrator.takeResults(results); ++wait) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].serial, "B");
+    ASSERT_TRUE(results[0].solved);
+    EXPECT_EQ(results[0].pairs, 40u * ExtrinsicCalibrator::POINTS_PER_SAMPLE);
+    EXPECT_LT(results[0].rmsErrorMm, 0.1f);
+    expectNear(results[0].transform, truth(), 1e-4f, 0.1f);
+    EXPECT_FALSE(calibrator.isSolving());
+    EXPECT_EQ(calibrator.getThreadPlacementReport().rfind("calibration: ", 0), 0u); // The solve thread was placed
+}
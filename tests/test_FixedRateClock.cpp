@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include "../src/core/FixedRateClock.hpp"
+#include <cstdint>
+
+TEST(FixedRateClock, TicksAreComputedFromTheStartWithoutDrift) {
+    FixedRateClock clock(120.0); // 8333333.33 ns: rounding would drift if accumulated
+    clock.reset(1'000'000'000);
+    EXPECT_EQ(clock.nextTickNs(), 1'000'000'000);
+    int64_t tick = 0;
+    for (int i = 0; i < 1200; ++i) tick = clock.advance(clock.nextTickNs()); // Always exactly on time
+    EXPECT_EQ(tick, 1'000'000'000 + 9'991'666'667); // Tick 1199
+    EXPECT_EQ(clock.nextTickNs(), 11'000'000'000);  // Tick 1200: ten seconds on the dot
+    EXPECT_EQ(clock.skippedTicks(), 0u);
+}
+
+TEST(FixedRateClock, LateCallerSkipsMissedTicksInsteadOfBursting) {
+    FixedRateClock clock(1000.0);
+    clock.reset(0);
+    EXPECT_EQ(clock.advance(0), 0);
+    EXPECT_EQ(clock.advance(1'400'000), 1'000'000); // Late but within a period: taken as is
+    EXPECT_EQ(clock.advance(5'500'000), 5'000'000); // Ticks 2-4 are gone
+    EXPECT_EQ(clock.skippedTicks(), 3u);
+    EXPECT_EQ(clock.nextTickNs(), 6'000'000);
+    EXPECT_EQ(clock.advance(5'900'000), 6'000'000); // Early: the due tick is still the next one
+    EXPECT_EQ(clock.skippedTicks(), 3u);
+}
+
+TEST(FixedRateClock, WaitReturnsOnTheTick) {
+    FixedRateClock clock(500.0);
+    const int64_t start = FixedRateClock::now();
+    clock.reset(start);
+    int64_t tick = 0;
+    for (int i = 0; i < 10; ++i) tick = clock.wait();
+    const int64_t after = FixedRateClock::now();
+    EXPECT_GE(after, tick);
+    EXPECT_GE(tick, start + 18'000'000); // At least tick 9, however loaded the machine
+    EXPECT_EQ(clock.nextTickIndex() * 2'000'000, static_cast<uint64_t>(clock.nextTickNs() - start));
+}
+
+TEST(FixedRateClock, InputModeNames) {
+    EXPECT_EQ(inputModeFromString(inputModeToString(InputMode::Interpolated)), InputMode::Interpolated);
+    EXPECT_EQ(inputModeFromString("events"), InputMode::Events);
+    EXPECT_EQ(inputModeFromString("bogus"), InputMode::Events);
+}
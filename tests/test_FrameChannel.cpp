@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "../src/core/FrameChannel.hpp"
+#include <vector>
+
+namespace {
+FrameData makeFrame(const std::string& deviceId, uint64_t timestamp) {
+    FrameData frame;
+    frame.deviceId = deviceId;
+    frame.timestamp = timestamp;
+    frame.hands.resize(1);
+    return frame;
+}
+
+// Drains everything currently waiting, returning timestamps in receive order.
+std::vector<uint64_t> drain(FrameChannel& channel) {
+    std::vector<uint64_t> timestamps;
+    while (FrameData* frame = channel.receive()) {
+        timestamps.push_back(frame->timestamp);
+        channel.release(frame);
+    }
+    return timestamps;
+}
+}
+
+TEST(FrameChannelTest, DeliversFramesInOrderAndStampsDeviceSlot) {
+    FrameChannel channel(8);
+    channel.publish(makeFrame("A", 1));
+    channel.publish(makeFrame("B", 2));
+
+    FrameData* first = channel.receive();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->deviceId, "A");
+    EXPECT_EQ(first->deviceSlot, 0);
+    channel.release(first);
+
+    FrameData* second = channel.receive();
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->deviceSlot, 1);
+    channel.release(second);
+
+    EXPECT_EQ(channel.receive(), nullptr);
+    EXPECT_EQ(channel.getTotalDropped(), 0u);
+    EXPECT_EQ(channel.getHighWater(), 2u);
+}
+
+TEST(FrameChannelTest, DropNewestKeepsOldFramesAndCountsDrops) {
+    FrameChannel channel(4, FrameOverflowPolicy::DropNewest);
+    for (uint64_t t = 1; t <= 6; ++t) {
+        channel.publish(makeFrame("A", t));
+    }
+    EXPECT_EQ(drain(channel), (std::vector<uint64_t>{1, 2, 3, 4}));
+
+    FrameChannel::DeviceStats stats = channel.getDeviceStats(0);
+    EXPECT_EQ(stats.dropped, 2u);
+    EXPECT_EQ(stats.highWater, 4u);
+    EXPECT_EQ(stats.pending, 0u);
+}
+
+TEST(FrameChannelTest, DropOldestKeepsNewestFrames) {
+    FrameChannel channel(4, FrameOverflowPolicy::DropOldest);
+    for (uint64_t t = 1; t <= 6; ++t) {
+        EXPECT_TRUE(channel.publish(makeFrame("A", t)));
+    }
+    EXPECT_EQ(drain(channel), (std::vector<uint64_t>{3, 4, 5, 6}));
+    EXPECT_EQ(channel.getDeviceStats(0).dropped, 2u);
+    EXPECT_EQ(channel.getDeviceStats(0).pending, 0u);
+}
+
+TEST(FrameChannelTest, DropOldestChargesTheEvictedDevice) {
+    FrameChannel channel(2, FrameOverflowPolicy::DropOldest);
+    channel.publish(makeFrame("A", 1));
+    channel.publish(makeFrame("B", 2));
+    channel.publish(makeFrame("B", 3)); // Evicts A's frame
+    EXPECT_EQ(channel.getDeviceStats(0).dropped, 1u);
+    EXPECT_EQ(channel.getDeviceStats(1).dropped, 0u);
+    EXPECT_EQ(drain(channel), (std::vector<uint64_t>{2, 3}));
+}
+
+TEST(FrameChannelTest, CoalesceKeepsLatestFramePerDevice) {
+    FrameChannel channel(8, FrameOverflowPolicy::CoalesceLatest);
+    for (uint64_t t = 1; t <= 5; ++t) {
+        channel.publish(makeFrame("A", t));
+        channel.publish(makeFrame("B", 100 + t));
+    }
+    std::vector<uint64_t> received = drain(channel);
+    ASSERT_EQ(received.size(), 2u);
+    EXPECT_EQ(received[0], 5u);
+    EXPECT_EQ(received[1], 105u);
+
+    EXPECT_EQ(channel.getDeviceStats(0).dropped, 4u);
+    EXPECT_EQ(channel.getDeviceStats(1).dropped, 4u);
+    EXPECT_EQ(channel.getDeviceStats(0).highWater, 1u);
+    EXPECT_EQ(channel.getTotalDropped(), 8u);
+}
+
+TEST(FrameChannelTest, CoalesceRecyclesEvictedFramesWithoutExhaustingThePool) {
+    FrameChannel channel(2, FrameOverflowPolicy::CoalesceLatest);
+    for (uint64_t t = 1; t <= 1000; ++t) {
+        EXPECT_TRUE(channel.publish(makeFrame("A", t)));
+    }
+    EXPECT_EQ(drain(channel), (std::vector<uint64_t>{1000}));
+}
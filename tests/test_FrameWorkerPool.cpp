@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "../src/pipeline/03_FrameWorkerPool.hpp"
+#include "../src/core/FrameData.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+FrameData makeFrame(size_t device, float sequence) {
+    FrameData frame;
+    frame.deviceId = "serial" + std::to_string(device);
+    frame.deviceSlot = static_cast<uint8_t>(device);
+    frame.hands.resize(2);
+    frame.hands[0].handType = HandType::Left;
+    frame.hands[0].palm.position = {sequence, 2.0f, 3.0f};
+    frame.hands[1].handType = HandType::Right;
+    frame.hands[1].palm.position = {sequence, 5.0f, 6.0f};
+    return frame;
+}
+
+// Sink for drain()/flush() that forwards messages to a callback
+template<typename OnMessage>
+struct Sink {
+    OnMessage onMessage;
+    size_t bundles = 0;
+    void sendOscMessage(const OscMessage& message) { onMessage(message); }
+    void sendOscBundle(const OscBundle& bundle) {
+        ++bundles;
+        for (const OscMessage& message : bundle.messages) onMessage(message);
+    }
+};
+template<typename OnMessage>
+Sink<OnMessage> makeSink(OnMessage onMessage) { return Sink<OnMessage>{onMessage}; }
+
+template<typename S>
+void submitAll(FrameWorkerPool& pool, const FrameData& frame, S& sink) {
+    while (!pool.submit(frame)) pool.drain(sink);
+}
+}
+
+TEST(FrameWorkerPoolTest, DevicesMapToOneWorker) {
+    DeviceAliasManager aliasMgr;
+    LeapSorter sorter(nullptr);
+    FrameWorkerPool pool(4, sorter, aliasMgr, nullptr, nullptr);
+    EXPECT_EQ(pool.workerCount(), 4u);
+    EXPECT_EQ(pool.workerFor(0), 0u);
+    EXPECT_EQ(pool.workerFor(5), 1u);
+    EXPECT_EQ(pool.workerFor(INVALID_DEVICE_SLOT), 0u);
+    const std::vector<std::string> reports = pool.getThreadPlacementReports();
+    ASSERT_EQ(reports.size(), 4u);
+    EXPECT_EQ(reports[3].rfind("frame-worker-3: ", 0), 0u) << reports[3]; // Named and placed once constructed
+    EXPECT_THROW(FrameWorkerPool(0, sorter, aliasMgr, nullptr, nullptr), std::invalid_argument);
+}
+
+TEST(FrameWorkerPoolTest, KeepsEachDevicesFramesInOrder) {
+    const size_t devices = 8;
+    const int framesPerDevice = 300;
+    DeviceAliasManager aliasMgr;
+    for (size_t d = 0; d < devices; ++d) aliasMgr.getOrAssignAlias("serial" + std::to_string(d));
+    LeapSorter sorter(nullptr);
+    // Small rings so workers hit both full input and full output
+    FrameWorkerPool pool(3, sorter, aliasMgr, nullptr, nullptr, {}, 4, 16);
+    pool.setFieldMask(oscFieldBit(OscField::Palm));
+
+    std::map<std::string, std::vector<float>> received;
+    auto send = makeSink([&](const OscMessage& msg) {
+        if (msg.address.size() > 7 && msg.address.compare(msg.address.size() - 7, 7, "palm/tx") == 0) {
+            received[msg.address].push_back(msg.values[0]);
+        }
+    });
+    for (int i = 0; i < framesPerDevice; ++i) {
+        for (size_t d = 0; d < devices; ++d) submitAll(pool, makeFrame(d, static_cast<float>(i)), send);
+    }
+    pool.flush(send);
+
+    EXPECT_EQ(pool.getProcessedFrames(), pool.getSubmittedFrames());
+    ASSERT_EQ(received.size(), devices * 2); // left and right of every device
+    for (const auto& [address, values] : received) {
+        ASSERT_EQ(values.size(), static_cast<size_t>(framesPerDevice)) << address;
+        EXPECT_TRUE(std::is_sorted(values.begin(), values.end())) << address;
+        EXPECT_EQ(values.back(), framesPerDevice - 1.0f) << address;
+    }
+}
+
+TEST(FrameWorkerPoolTest, AppliesHandAssignments) {
+    DeviceAliasManager aliasMgr;
+    aliasMgr.getOrAssignAlias("serial0");
+    aliasMgr.getOrAssignAlias("serial1");
+    LeapSorter sorter(nullptr);
+    sorter.setDeviceHand("serial1", "RIGHT");
+    FrameWorkerPool pool(2, sorter, aliasMgr, nullptr, nullptr);
+    pool.setFieldMask(oscFieldBit(OscField::Palm));
+
+    std::vector<std::string> addresses;
+    auto send = makeSink([&](const OscMessage& msg) { addresses.push_back(msg.address); });
+    submitAll(pool, makeFrame(0, 1.0f), send);
+    submitAll(pool, makeFrame(1, 1.0f), send);
+    pool.flush(send);
+
+    auto sent = [&](const std::string& address) {
+        return std::find(addresses.begin(), addresses.end(), address) != addresses.end();
+    };
+    EXPECT_TRUE(sent("/leap/dev1/left/palm/tx"));
+    EXPECT_TRUE(sent("/leap/dev1/right/palm/tx"));
+    EXPECT_FALSE(sent("/leap/dev2/left/palm/tx"));
+    EXPECT_TRUE(sent("/leap/dev2/right/palm/tx"));
+}
+
+TEST(FrameWorkerPoolTest, DeviceLossZeroesAsBundles) {
+    DeviceAliasManager aliasMgr;
+    LeapSorter sorter(nullptr);
+    FrameWorkerPool pool(2, sorter, aliasMgr, nullptr, nullptr);
+    pool.setFieldMask(oscFieldBit(OscField::Palm));
+
+    size_t zeros = 0;
+    auto send = makeSink([&](const OscMessage& msg) { if (msg.values[0] == 0.f) ++zeros; });
+    submitAll(pool, makeFrame(1, 1.0f), send);
+    FrameData lost;
+    lost.deviceId = "serial1";
+    lost.deviceSlot = 1;
+    lost.deviceLost = true;
+    submitAll(pool, lost, send);
+    pool.flush(send);
+
+    EXPECT_EQ(send.bundles, 2u); // left and right
+    EXPECT_EQ(zeros, 6u);        // palm x/y/z per hand
+}
+
+TEST(FrameWorkerPoolTest, GestureEventsDrainAheadOfValues) {
+    DeviceAliasManager aliasMgr;
+    LeapSorter sorter(nullptr);
+    FrameWorkerPool pool(2, sorter, aliasMgr, nullptr, nullptr);
+    pool.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::Gestures));
+
+    std::vector<std::string> sent;
+    auto send = makeSink([&](const OscMessage& msg) { sent.push_back(msg.address); });
+    for (size_t device = 0; device < 2; ++device) submitAll(pool, makeFrame(device, 1.0f), send);
+    while (pool.getProcessedFrames() < 2) std::this_thread::yield();
+    pool.drain(send);
+
+    // Both devices' hand-enter events come before any palm value
+    ASSERT_EQ(sent.size(), 4u + 12u);
+    for (size_t i = 0; i < 4; ++i) EXPECT_NE(sent[i].find("/event/enter"), std::string::npos) << sent[i];
+}
+
+// Throughput for 1-16 synthetic devices, inline (one DataProcessor on the
+// calling thread, as with processing_workers = 0) against the pool. Prints a
+// table; only correctness is asserted, since timings depend on the machine.
+TEST(FrameWorkerPoolTest, ScalingBenchmark) {
+    const int framesPerDevice = 400;
+    const size_t cores = (std::max)(1u, std::thread::hardware_concurrency());
+    const OscFieldMask fields = ~OscFieldMask(0);
+    std::cout << "devices  workers  inline fps  pool fps  speedup\n";
+
+    for (size_t devices : {1u, 2u, 4u, 8u, 16u}) {
+        std::vector<FrameData> frames;
+        for (size_t d = 0; d < devices; ++d) frames.push_back(makeFrame(d, 1.0f));
+        const double totalFrames = static_cast<double>(devices * framesPerDevice);
+        uint64_t sink = 0;
+
+        DeviceAliasManager aliasMgr;
+        LeapSorter sorter(nullptr);
+        DataProcessor inlineProcessor(aliasMgr, [&](const OscMessage& msg) { sink += msg.values.size(); }, nullptr, nullptr);
+        inlineProcessor.setFieldMask(fields);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < framesPerDevice; ++i) {
+            for (const FrameData& frame : frames) {
+                inlineProcessor.processData(frame.deviceId, frame, sorter.selectHands(frame.deviceId, frame));
+            }
+        }
+        const double inlineSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const uint64_t inlineMessages = sink;
+
+        const size_t workers = (std::min)(devices, cores);
+        FrameWorkerPool pool(workers, sorter, aliasMgr, nullptr, nullptr);
+        pool.setFieldMask(fields);
+        sink = 0;
+        auto send = makeSink([&](const OscMessage& msg) { sink += msg.values.size(); });
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < framesPerDevice; ++i) {
+            for (const FrameData& frame : frames) submitAll(pool, frame, send);
+            pool.drain(send);
+        }
+        pool.flush(send);
+        const double poolSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        EXPECT_EQ(sink, inlineMessages);
+        std::cout << std::setw(7) << devices << std::setw(9) << workers
+                  << std::setw(12) << static_cast<long>(totalFrames / inlineSeconds)
+                  << std::setw(10) << static_cast<long>(totalFrames / poolSeconds)
+                  << std::setw(8) << std::fixed << std::setprecision(2) << inlineSeconds / poolSeconds << "x\n";
+    }
+}
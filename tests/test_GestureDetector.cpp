@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "../src/core/GestureDetector.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+constexpr uint64_t FRAME_US = 10'000; // 100 Hz
+
+GestureEvents bit(GestureEvent event) { return gestureEventBit(event); }
+
+HandData handAt(float palmX, float palmY = 200.0f, float tipY = 180.0f) {
+    HandData hand;
+    hand.palm.position = {palmX, palmY, 0.0f};
+    hand.fingers[1].bones[3].nextJoint = {palmX, tipY, -80.0f};
+    return hand;
+}
+}
+
+TEST(GestureDetectorTest, PinchAndGrabUseHysteresis) {
+    GestureDetector detector;
+    GestureConfig config;
+    HandData hand = handAt(0.0f);
+    uint64_t t = 0;
+    EXPECT_EQ(detector.update(hand, t += FRAME_US, config), 0u);
+    hand.pinchStrength = 0.85f;
+    hand.grabStrength = 0.9f;
+    EXPECT_EQ(detector.update(hand, t += FRAME_US, config), bit(GestureEvent::PinchStart) | bit(GestureEvent::GrabStart));
+    hand.pinchStrength = 0.7f; // Between off and on: still pinching
+    EXPECT_EQ(detector.update(hand, t += FRAME_US, config), 0u);
+    hand.pinchStrength = 0.82f;
+    EXPECT_EQ(detector.update(hand, t += FRAME_US, config), 0u);
+    hand.pinchStrength = 0.5f;
+    EXPECT_EQ(detector.update(hand, t += FRAME_US, config), bit(GestureEvent::PinchEnd));
+
+    // A lost hand ends what it still holds
+    EXPECT_EQ(detector.release(), bit(GestureEvent::GrabEnd));
+    EXPECT_EQ(detector.release(), 0u);
+}
+
+TEST(GestureDetectorTest, SwipeFiresOncePerStroke) {
+    GestureDetector detector;
+    GestureConfig config;
+    uint64_t t = 0;
+    float x = 0.0f;
+    GestureEvents events = 0;
+    for (int i = 0; i < 20; ++i) events |= detector.update(handAt(x -= 12.0f), t += FRAME_US, config); // 1200 mm/s left
+    EXPECT_EQ(events, bit(GestureEvent::SwipeLeft));
+
+    // Re-arms once the palm slows below half the swipe speed
+    events = 0;
+    for (int i = 0; i < 20; ++i) events |= detector.update(handAt(x), t += FRAME_US, config);
+    for (int i = 0; i < 20; ++i) events |= detector.update(handAt(x, 200.0f + 12.0f * i), t += FRAME_US, config);
+    EXPECT_EQ(events, bit(GestureEvent::SwipeUp));
+}
+
+TEST(GestureDetectorTest, TapIsAShortDownStrokeWithAStillPalm) {
+    GestureDetector detector;
+    GestureConfig config;
+    uint64_t t = 0;
+    GestureEvents events = 0;
+    float tip = 180.0f;
+    for (int i = 0; i < 10; ++i) events |= detector.update(handAt(0.0f, 200.0f, tip), t += FRAME_US, config);
+    for (int i = 0; i < 5; ++i) events |= detector.update(handAt(0.0f, 200.0f, tip -= 5.0f), t += FRAME_US, config); // 500 mm/s
+    for (int i = 0; i < 5; ++i) events |= detector.update(handAt(0.0f, 200.0f, tip), t += FRAME_US, config);
+    EXPECT_EQ(events, bit(GestureEvent::Tap));
+
+    // Too slow a stroke is no tap
+    events = 0;
+    for (int i = 0; i < 20; ++i) events |= detector.update(handAt(0.0f, 200.0f, tip -= 1.0f), t += FRAME_US, config);
+    for (int i = 0; i < 5; ++i) events |= detector.update(handAt(0.0f, 200.0f, tip), t += FRAME_US, config);
+    EXPECT_EQ(events, 0u);
+}
+
+TEST(GestureDetectorTest, DataProcessorSendsEventsAheadOfValues) {
+    DeviceAliasManager aliasMgr;
+    std::vector<std::string> sent;
+    std::vector<std::string> events;
+    DataProcessor proc{aliasMgr, [&](const OscMessage& msg) { sent.push_back(msg.address); }, nullptr, nullptr};
+    proc.setOscEventCallback([&](const OscMessage& msg) {
+        events.push_back(msg.address);
+        EXPECT_EQ(msg.values, std::vector<float>{1.f});
+        EXPECT_TRUE(sent.empty()); // Nothing of the frame went out before its events
+    });
+    proc.setFieldMask(oscFieldBit(OscField::Gestures) | oscFieldBit(OscField::PinchStrength));
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    frame.hands.push_back(handAt(0.0f));
+    frame.hands[0].pinchStrength = 0.9f;
+    proc.processData(frame.deviceId, frame);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0], "/leap/dev1/left/event/enter");
+    EXPECT_EQ(events[1], "/leap/dev1/left/event/pinch/start");
+    EXPECT_EQ(sent, std::vector<std::string>{"/leap/dev1/left/pinchStrength"});
+
+    events.clear();
+    sent.clear();
+    frame.hands.clear();
+    proc.processData(frame.deviceId, frame);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0], "/leap/dev1/left/event/pinch/end");
+    EXPECT_EQ(events[1], "/leap/dev1/left/event/exit");
+}
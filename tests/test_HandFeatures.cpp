@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "../src/core/HandFeatures.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr float PI = 3.14159265f;
+
+// Palm facing down (normal -y), every finger straight along -z from x = baseX[f].
+// The thumb's metacarpal has zero length, as LeapC reports it.
+HandData flatHand() {
+    HandData hand;
+    hand.palm.normal = {0.0f, -1.0f, 0.0f};
+    const float baseX[5] = { -40.0f, -20.0f, 0.0f, 20.0f, 40.0f };
+    for (size_t f = 0; f < 5; ++f) {
+        Vector3 joint = { baseX[f], 200.0f, 0.0f };
+        for (size_t b = 0; b < 4; ++b) {
+            BoneData& bone = hand.fingers[f].bones[b];
+            bone.prevJoint = joint;
+            if (f > 0 || b > 0) joint.z -= 30.0f;
+            bone.nextJoint = joint;
+        }
+    }
+    return hand;
+}
+
+// Turns bones b.. of a finger down by degrees, about the x axis through bone b's start
+void bend(FingerData& finger, size_t b, float degrees) {
+    const float a = degrees * PI / 180.0f;
+    const Vector3 pivot = finger.bones[b].prevJoint;
+    auto turn = [&](Vector3& p) {
+        const float y = p.y - pivot.y, z = p.z - pivot.z;
+        p.y = pivot.y + y * std::cos(a) + z * std::sin(a);
+        p.z = pivot.z - y * std::sin(a) + z * std::cos(a);
+    };
+    for (size_t i = b; i < 4; ++i) {
+        if (i > b) turn(finger.bones[i].prevJoint);
+        turn(finger.bones[i].nextJoint);
+    }
+}
+
+// Rotates the proximal bone onwards of a finger about the palm normal
+void splay(FingerData& finger, float degrees) {
+    const float a = degrees * PI / 180.0f;
+    const Vector3 pivot = finger.bones[1].prevJoint;
+    for (size_t i = 1; i < 4; ++i) {
+        for (Vector3* p : { &finger.bones[i].prevJoint, &finger.bones[i].nextJoint }) {
+            const float x = p->x - pivot.x, z = p->z - pivot.z;
+            p->x = pivot.x + x * std::cos(a) - z * std::sin(a);
+            p->z = pivot.z + x * std::sin(a) + z * std::cos(a);
+        }
+    }
+}
+
+Quaternion aboutAxis(float degrees, float x, float y, float z) {
+    const float half = degrees * PI / 360.0f;
+    return { std::cos(half), x * std::sin(half), y * std::sin(half), z * std::sin(half) };
+}
+}
+
+TEST(HandFeaturesTest, FlatHandIsStraightAndOpen) {
+    DerivedHandData out;
+    computeHandFeatures(flatHand(), out);
+    for (size_t f = 0; f < 5; ++f) {
+        for (float flexion : out.flexion[f]) EXPECT_NEAR(flexion, 0.0f, 0.05f);
+        EXPECT_NEAR(out.curl[f], 0.0f, 1e-3f);
+    }
+    for (float spread : out.spread) EXPECT_NEAR(spread, 0.0f, 0.05f);
+    EXPECT_NEAR(out.openness, 1.0f, 1e-3f);
+}
+
+TEST(HandFeaturesTest, FlexionPerJointAndCurl) {
+    HandData hand = flatHand();
+    bend(hand.fingers[1], 2, 90.0f); // Index PIP
+    bend(hand.fingers[1], 3, 45.0f); // Index DIP
+    DerivedHandData out;
+    computeHandFeatures(hand, out);
+    EXPECT_NEAR(out.flexion[1][0], 0.0f, 0.05f);
+    EXPECT_NEAR(out.flexion[1][1], 90.0f, 0.05f);
+    EXPECT_NEAR(out.flexion[1][2], 45.0f, 0.05f);
+    EXPECT_NEAR(out.curl[1], 135.0f / FULL_CURL_DEGREES, 1e-3f);
+    EXPECT_NEAR(out.curl[2], 0.0f, 1e-3f);
+    EXPECT_NEAR(out.openness, 1.0f - 0.5f / 5.0f, 1e-3f);
+}
+
+TEST(HandFeaturesTest, ZeroLengthThumbMetacarpalHasNoFlexion) {
+    HandData hand = flatHand();
+    bend(hand.fingers[0], 2, 40.0f); // Thumb IP
+    DerivedHandData out;
+    computeHandFeatures(hand, out);
+    EXPECT_EQ(out.flexion[0][0], 0.0f); // Not the 90 degrees of an undefined direction
+    EXPECT_NEAR(out.flexion[0][1], 40.0f, 0.05f);
+    EXPECT_NEAR(out.flexion[0][2], 0.0f, 0.05f);
+    EXPECT_NEAR(out.curl[0], 40.0f / FULL_CURL_DEGREES, 1e-3f);
+}
+
+TEST(HandFeaturesTest, SpreadIsMeasuredInThePalmPlane) {
+    HandData hand = flatHand();
+    splay(hand.fingers[1], 15.0f);
+    bend(hand.fingers[2], 1, 60.0f); // Middle curled at the MCP: no sideways angle
+    DerivedHandData out;
+    computeHandFeatures(hand, out);
+    EXPECT_NEAR(out.spread[0], 15.0f, 0.05f);
+    EXPECT_NEAR(out.spread[1], 15.0f, 0.05f);
+    EXPECT_NEAR(out.spread[2], 0.0f, 0.05f);
+
+    hand.fingers[4].setValid(false);
+    computeHandFeatures(hand, out);
+    EXPECT_EQ(out.spread[3], 0.0f);
+}
+
+TEST(HandFeaturesTest, PalmRollPitchYaw) {
+    HandData hand = flatHand();
+    DerivedHandData out;
+    computeHandFeatures(hand, out);
+    EXPECT_NEAR(out.palmRoll, 0.0f, 1e-3f);
+    EXPECT_NEAR(out.palmPitch, 0.0f, 1e-3f);
+    EXPECT_NEAR(out.palmYaw, 0.0f, 1e-3f);
+
+    hand.palm.orientation = aboutAxis(30.0f, 0.0f, 0.0f, 1.0f);
+    computeHandFeatures(hand, out);
+    EXPECT_NEAR(out.palmRoll, 30.0f, 0.01f);
+    EXPECT_NEAR(out.palmPitch, 0.0f, 0.01f);
+
+    hand.palm.orientation = aboutAxis(20.0f, 1.0f, 0.0f, 0.0f);
+    computeHandFeatures(hand, out);
+    EXPECT_NEAR(out.palmPitch, 20.0f, 0.01f);
+    EXPECT_NEAR(out.palmRoll, 0.0f, 0.01f);
+
+    hand.palm.orientation = aboutAxis(-40.0f, 0.0f, 1.0f, 0.0f);
+    computeHandFeatures(hand, out);
+    EXPECT_NEAR(out.palmYaw, 40.0f, 0.01f);
+}
+
+TEST(HandFeaturesTest, SentOnlyForEnabledFields) {
+    DeviceAliasManager aliasMgr;
+    std::vector<OscMessage> sent;
+    DataProcessor proc{aliasMgr, [&](const OscMessage& msg) { sent.push_back(msg); }, nullptr, nullptr};
+    proc.setFieldMask(oscFieldBit(OscField::FingerCurl));
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    frame.hands.push_back(flatHand());
+    bend(frame.hands[0].fingers[1], 2, 90.0f);
+    proc.processData(frame.deviceId, frame);
+
+    ASSERT_EQ(sent.size(), 5u); // One curl per finger
+    EXPECT_EQ(sent[1].address, "/leap/dev1/left/finger/index/curl");
+    EXPECT_NEAR(sent[1].values[0], 90.0f / FULL_CURL_DEGREES, 1e-3f);
+}
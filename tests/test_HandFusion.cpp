@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "../src/core/HandFusion.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <string>
+
+namespace {
+// 90 degrees about +y: x -> -z, z -> x
+RigidTransform quarterTurnY(Vector3 translation) {
+    RigidTransform transform;
+    transform.rotation = { 0, 0, 1,
+                           0, 1, 0,
+                           -1, 0, 0 };
+    transform.translation = translation;
+    return transform;
+}
+
+FrameData frame(const std::string& device, uint8_t slot, uint64_t timestampUs, Vector3 palm, float confidence,
+                Vector3 velocity = {}) {
+    FrameData f;
+    f.deviceId = device;
+    f.deviceSlot = slot;
+    f.timestamp = timestampUs;
+    f.hands.resize(1);
+    f.hands[0].handType = HandType::Right;
+    f.hands[0].palm.position = palm;
+    f.hands[0].palm.velocity = velocity;
+    f.hands[0].palm.normal = {0.0f, -1.0f, 0.0f};
+    f.hands[0].confidence = confidence;
+    return f;
+}
+}
+
+TEST(HandFusion, TransformMovesPointsDirectionsAndRotations) {
+    const RigidTransform transform = quarterTurnY({10.0f, 0.0f, 0.0f});
+    HandData hand;
+    hand.palm.position = {1.0f, 2.0f, 3.0f};
+    hand.palm.direction = {0.0f, 0.0f, -1.0f};
+    hand.fingers[1].bones[3].nextJoint = {1.0f, 0.0f, 0.0f};
+    transformHand(transform, hand);
+
+    EXPECT_NEAR(hand.palm.position.x, 13.0f, 1e-5f);
+    EXPECT_NEAR(hand.palm.position.y, 2.0f, 1e-5f);
+    EXPECT_NEAR(hand.palm.position.z, -1.0f, 1e-5f);
+    EXPECT_NEAR(hand.palm.direction.x, -1.0f, 1e-5f); // Directions are only rotated
+    EXPECT_NEAR(hand.fingers[1].bones[3].nextJoint.z, -1.0f, 1e-5f);
+    // Identity orientation becomes the transform's rotation: w = y = sqrt(1/2)
+    EXPECT_NEAR(hand.palm.orientation.w, 0.70710678f, 1e-5f);
+    EXPECT_NEAR(hand.palm.orientation.y, 0.70710678f, 1e-5f);
+
+    const RigidTransform roundTrip = RigidTransform::fromMatrix(transform.toMatrix());
+    EXPECT_EQ(roundTrip.rotation, transform.rotation);
+    EXPECT_FLOAT_EQ(roundTrip.translation.x, 10.0f);
+}
+
+TEST(HandFusion, MergesDevicesWeightedByConfidence) {
+    HandFusion fusion;
+    FusionConfig config;
+    config.extrinsics["B"].translation = {100.0f, 0.0f, 0.0f}; // Device B sits 100 mm to the right
+    fusion.setConfig(config);
+
+    fusion.update(frame("A", 0, 1000, {40.0f, 200.0f, 0.0f}, 0.75f));
+    fusion.update(frame("B", 1, 1000, {-40.0f, 200.0f, 0.0f}, 0.25f)); // x = 60 in room space
+
+    FrameData fused;
+    fusion.fuse(fused);
+    EXPECT_EQ(fused.deviceId, FUSED_DEVICE_ID);
+    EXPECT_EQ(fused.timestamp, 1000u);
+    ASSERT_EQ(fused.hands.size(), 1u);
+    EXPECT_EQ(fused.hands[0].handType, HandType::Right);
+    EXPECT_NEAR(fused.hands[0].palm.position.x, 45.0f, 1e-4f);
+    EXPECT_NEAR(fused.hands[0].palm.normal.y, -1.0f, 1e-5f);
+    EXPECT_FLOAT_EQ(fused.hands[0].confidence, 0.75f); // The anchor's
+}
+
+TEST(HandFusion, KeepsTheAnchorAloneOutsideTheRadiusAndDropsStaleDevices) {
+    HandFusion fusion;
+    FusionConfig config;
+    config.associationRadiusMm = 50.0f;
+    config.maxAgeMs = 20;
+    fusion.setConfig(config);
+
+    fusion.update(frame("A", 0, 100'000, {0.0f, 200.0f, 0.0f}, 0.9f));
+    fusion.update(frame("B", 1, 100'000, {120.0f, 200.0f, 0.0f}, 0.5f)); // Another person's hand
+    FrameData fused;
+    fusion.fuse(fused);
+    ASSERT_EQ(fused.hands.size(), 1u);
+    EXPECT_FLOAT_EQ(fused.hands[0].palm.position.x, 0.0f);
+
+    fusion.update(frame("B", 1, 150'000, {120.0f, 200.0f, 0.0f}, 0.5f)); // A is now 50 ms old
+    fusion.fuse(fused);
+    ASSERT_EQ(fused.hands.size(), 1u);
+    EXPECT_FLOAT_EQ(fused.hands[0].palm.position.x, 120.0f);
+
+    FrameData lost;
+    lost.deviceId = "B";
+    lost.deviceSlot = 1;
+    lost.deviceLost = true;
+    fusion.update(lost);
+    fusion.fuse(fused);
+    EXPECT_TRUE(fused.hands.empty());
+}
+
+TEST(HandFusion, OlderFramesAreMovedForwardByPalmVelocity) {
+    HandFusion fusion;
+    fusion.setConfig(FusionConfig());
+
+    // A saw the hand 10 ms before B, moving at +1000 mm/s along x
+    fusion.update(frame("A", 0, 1'000'000, {0.0f, 200.0f, 0.0f}, 0.5f, {1000.0f, 0.0f, 0.0f}));
+    fusion.update(frame("B", 1, 1'010'000, {10.0f, 200.0f, 0.0f}, 0.5f, {1000.0f, 0.0f, 0.0f}));
+
+    FrameData fused;
+    fusion.fuse(fused);
+    ASSERT_EQ(fused.hands.size(), 1u);
+    EXPECT_NEAR(fused.hands[0].palm.position.x, 10.0f, 1e-3f);
+    EXPECT_NEAR(fused.hands[0].palm.velocity.x, 1000.0f, 1e-3f);
+}
+
+TEST(HandFusion, StaleAnchorIsMovedForwardBeforeAssociating) {
+    HandFusion fusion;
+    FusionConfig config;
+    config.associationRadiusMm = 50.0f;
+    fusion.setConfig(config);
+
+    // The most confident device saw the hand 40 ms ago; at 1500 mm/s it has
+    // since moved 60 mm, to within 10 mm of where B sees it now.
+    fusion.update(frame("A", 0, 1'000'000, {0.0f, 200.0f, 0.0f}, 0.9f, {1500.0f, 0.0f, 0.0f}));
+    fusion.update(frame("B", 1, 1'040'000, {70.0f, 200.0f, 0.0f}, 0.5f, {1500.0f, 0.0f, 0.0f}));
+
+    FrameData fused;
+    fusion.fuse(fused);
+    ASSERT_EQ(fused.hands.size(), 1u);
+    EXPECT_NEAR(fused.hands[0].palm.position.x, (0.9f * 60.0f + 0.5f * 70.0f) / 1.4f, 1e-3f); // Merged, not split
+}
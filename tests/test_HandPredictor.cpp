@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "../src/core/HandPredictor.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <cmath>
+#include <string>
+
+namespace {
+HandData handAt(float x) {
+    HandData hand;
+    hand.palm.position = {x, 200.0f, 0.0f};
+    hand.arm.wristPosition = {x, 150.0f, 0.0f};
+    for (FingerData& finger : hand.fingers) {
+        for (BoneData& bone : finger.bones) bone.nextJoint = {x, 250.0f, 10.0f};
+    }
+    return hand;
+}
+
+PredictionConfig mode(PredictionMode m, float lookaheadMs = 0.0f) {
+    PredictionConfig config;
+    config.mode = m;
+    config.lookaheadMs = lookaheadMs;
+    return config;
+}
+}
+
+TEST(HandPredictor, FirstFramePassesThrough) {
+    HandPredictor predictor;
+    HandData hand = handAt(5.0f);
+    predictor.apply(hand, 1000, 20'000, mode(PredictionMode::ConstantVelocity));
+    EXPECT_FLOAT_EQ(hand.palm.position.x, 5.0f);
+    EXPECT_FLOAT_EQ(hand.fingers[2].bones[3].nextJoint.x, 5.0f);
+}
+
+TEST(HandPredictor, ConstantVelocityExtrapolatesEveryJoint) {
+    HandPredictor predictor;
+    const PredictionConfig config = mode(PredictionMode::ConstantVelocity);
+    HandData hand = handAt(0.0f);
+    predictor.apply(hand, 1'000'000, 20'000, config);
+    hand = handAt(10.0f); // 1000 mm/s
+    predictor.apply(hand, 1'010'000, 20'000, config);
+    EXPECT_NEAR(hand.palm.position.x, 30.0f, 1e-3f);
+    EXPECT_NEAR(hand.arm.wristPosition.x, 30.0f, 1e-3f);
+    EXPECT_NEAR(hand.fingers[4].bones[3].nextJoint.x, 30.0f, 1e-3f);
+    EXPECT_NEAR(hand.fingers[4].bones[3].prevJoint.x, 30.0f, 1e-3f); // Bone chain kept joined
+    EXPECT_FLOAT_EQ(hand.palm.position.y, 200.0f);                   // Still axes stay put
+
+    hand = handAt(20.0f);
+    predictor.apply(hand, 1'010'000, 20'000, config); // Not newer: restarts, no velocity
+    EXPECT_FLOAT_EQ(hand.palm.position.x, 20.0f);
+}
+
+TEST(HandPredictor, KalmanTracksMotionAndDampsJitter) {
+    HandPredictor cv, kalman;
+    const PredictionConfig cvConfig = mode(PredictionMode::ConstantVelocity);
+    const PredictionConfig kalmanConfig = mode(PredictionMode::Kalman);
+    float cvSwing = 0.0f, kalmanSwing = 0.0f, kalmanError = 0.0f;
+    for (int i = 0; i < 240; ++i) {
+        // 500 mm/s at 120 Hz with +-0.5 mm of alternating noise
+        const float truth = 500.0f * i / 120.0f;
+        const float noise = (i % 2) ? 0.5f : -0.5f;
+        const uint64_t t = 1'000'000 + uint64_t(i) * 8333;
+        HandData a = handAt(truth + noise), b = handAt(truth + noise);
+        cv.apply(a, t, 20'000, cvConfig);
+        kalman.apply(b, t, 20'000, kalmanConfig);
+        if (i >= 120) {
+            const float target = truth + 500.0f * 0.02f;
+            cvSwing = (std::max)(cvSwing, std::abs(a.palm.position.x - target));
+            kalmanSwing = (std::max)(kalmanSwing, std::abs(b.palm.position.x - target));
+            kalmanError += (b.palm.position.x - target) / 120.0f;
+        }
+    }
+    EXPECT_GT(cvSwing, 2.0f); // Differencing noisy frames amplifies the noise
+    EXPECT_LT(kalmanSwing, cvSwing / 2.0f);
+    EXPECT_NEAR(kalmanError, 0.0f, 0.5f); // No lag once settled
+}
+
+TEST(HandPredictor, DataProcessorAddsMeasuredAgeUpToTheClamp) {
+    DeviceAliasManager aliases;
+    float sentX = 0.0f;
+    DataProcessor proc(aliases, [&](const OscMessage& msg) {
+        if (msg.address == "/leap/dev1/right/palm/tx") sentX = msg.values[0];
+    }, nullptr, nullptr);
+    proc.setFieldMask(oscFieldBit(OscField::Palm));
+    uint64_t now = 0;
+    proc.setClock([&]() { return now; });
+    PredictionConfig config = mode(PredictionMode::ConstantVelocity, 5.0f);
+    proc.setPrediction(config);
+
+    auto send = [&](float x, uint64_t timestamp) {
+        FrameData f;
+        f.deviceId = "serialA";
+        f.deviceSlot = 0;
+        f.timestamp = timestamp;
+        f.hands.push_back(handAt(x));
+        f.hands[0].handType = HandType::Right;
+        now = timestamp + 10'000; // Every frame is 10 ms old when processed
+        proc.processData(f.deviceId, f);
+    };
+    send(0.0f, 1'000'000);
+    send(10.0f, 1'010'000); // 1000 mm/s, 5 ms fixed + 10 ms measured
+    EXPECT_NEAR(sentX, 25.0f, 1e-3f);
+
+    config.lookaheadMs = 100.0f;
+    proc.setPrediction(config);
+    send(20.0f, 1'020'000); // Clamped to the default 30 ms
+    EXPECT_NEAR(sentX, 50.0f, 1e-3f);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "../src/core/HandSmoother.hpp"
+#include <cmath>
+
+namespace {
+SmoothingConfig allGroups(float minCutoff, float beta) {
+    SmoothingConfig config;
+    for (OneEuroParams& params : config.groups) {
+        params.enabled = true;
+        params.minCutoff = minCutoff;
+        params.beta = beta;
+    }
+    return config;
+}
+
+HandData handAt(float x) {
+    HandData hand;
+    hand.palm.position = {x, 200.0f, -x};
+    hand.arm.wristPosition = {x, 150.0f, 0.0f};
+    for (FingerData& finger : hand.fingers) {
+        for (BoneData& bone : finger.bones) bone.nextJoint = {x, 250.0f, 10.0f};
+    }
+    return hand;
+}
+
+// Textbook scalar One Euro filter, the reference for the vectorized one
+struct ReferenceOneEuro {
+    float minCutoff, beta, dCutoff;
+    bool initialized = false;
+    float value = 0.0f, speed = 0.0f;
+
+    static float alpha(float cutoff, float dt) {
+        const float r = 2.0f * 3.14159265f * cutoff * dt;
+        return r / (r + 1.0f);
+    }
+    float filter(float x, float dt) {
+        if (!initialized) {
+            initialized = true;
+            value = x;
+            return x;
+        }
+        const float rawSpeed = (x - value) / dt;
+        speed += alpha(dCutoff, dt) * (rawSpeed - speed);
+        const float cutoff = minCutoff + beta * std::fabs(speed);
+        value += alpha(cutoff, dt) * (x - value);
+        return value;
+    }
+};
+
+constexpr uint64_t FRAME_US = 8'333; // 120 fps
+}
+
+TEST(HandSmootherTest, FirstFramePassesThrough) {
+    HandSmoother smoother;
+    smoother.configure(allGroups(1.0f, 0.0f));
+    HandData hand = handAt(42.0f);
+    smoother.apply(hand, FRAME_US);
+    EXPECT_FLOAT_EQ(hand.palm.position.x, 42.0f);
+    EXPECT_FLOAT_EQ(hand.fingers[4].bones[3].nextJoint.x, 42.0f);
+}
+
+TEST(HandSmootherTest, MatchesScalarReference) {
+    HandSmoother smoother;
+    smoother.configure(allGroups(1.5f, 0.01f));
+    ReferenceOneEuro reference{1.5f, 0.01f, 1.0f};
+    for (int i = 0; i < 200; ++i) {
+        const float x = 100.0f * std::sin(i * 0.05f) + ((i % 3) - 1) * 2.0f;
+        HandData hand = handAt(x);
+        smoother.apply(hand, (i + 1) * FRAME_US);
+        const float expected = reference.filter(x, FRAME_US * 1e-6f);
+        ASSERT_NEAR(hand.palm.position.x, expected, 1e-3f) << "frame " << i;
+        ASSERT_NEAR(hand.palm.position.z, -expected, 1e-3f) << "frame " << i;
+        // Every joint lane runs the same filter
+        ASSERT_NEAR(hand.fingers[2].bones[1].nextJoint.x, expected, 1e-3f) << "frame " << i;
+        // Chained bones stay connected
+        EXPECT_EQ(hand.fingers[2].bones[2].prevJoint.x, hand.fingers[2].bones[1].nextJoint.x);
+    }
+}
+
+TEST(HandSmootherTest, ReducesJitterAtRest) {
+    HandSmoother smoother;
+    smoother.configure(allGroups(1.0f, 0.0f));
+    float maxDeviation = 0.0f;
+    for (int i = 0; i < 240; ++i) {
+        HandData hand = handAt(i % 2 ? 1.0f : -1.0f); // +-1 mm noise around 0
+        smoother.apply(hand, (i + 1) * FRAME_US);
+        if (i > 120) maxDeviation = (std::max)(maxDeviation, std::fabs(hand.palm.position.x));
+    }
+    EXPECT_LT(maxDeviation, 0.2f);
+}
+
+TEST(HandSmootherTest, DisabledGroupsPassThrough) {
+    SmoothingConfig config;
+    config[SmoothingGroup::Palm].enabled = true;
+    HandSmoother smoother;
+    smoother.configure(config);
+    HandData hand = handAt(0.0f);
+    smoother.apply(hand, FRAME_US);
+    hand = handAt(50.0f);
+    smoother.apply(hand, 2 * FRAME_US);
+    EXPECT_LT(hand.palm.position.x, 50.0f);
+    EXPECT_FLOAT_EQ(hand.arm.wristPosition.x, 50.0f);
+    EXPECT_FLOAT_EQ(hand.fingers[0].bones[0].nextJoint.x, 50.0f);
+}
+
+TEST(HandSmootherTest, ResetAndStaleTimestampsRestart) {
+    HandSmoother smoother;
+    smoother.configure(allGroups(1.0f, 0.0f));
+    HandData hand = handAt(0.0f);
+    smoother.apply(hand, FRAME_US);
+    smoother.reset();
+    hand = handAt(80.0f);
+    smoother.apply(hand, 2 * FRAME_US);
+    EXPECT_FLOAT_EQ(hand.palm.position.x, 80.0f);
+
+    hand = handAt(-80.0f);
+    smoother.apply(hand, 2 * FRAME_US); // Not newer: no dt to filter with
+    EXPECT_FLOAT_EQ(hand.palm.position.x, -80.0f);
+}
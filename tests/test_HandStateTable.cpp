@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "../src/core/HandStateTable.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+struct Counter {
+    int frames = 0;
+};
+
+HandData hand(uint32_t id, HandType type, float x = 0.0f) {
+    HandData h;
+    h.id = id;
+    h.handType = type;
+    h.palm.position = {x, 200.0f, 0.0f};
+    return h;
+}
+}
+
+TEST(HandStateTable, KeysByIdAndFallsBackToHandType) {
+    EXPECT_EQ(handStateKey(hand(7, HandType::Left)), 7u);
+    EXPECT_NE(handStateKey(hand(0, HandType::Left)), handStateKey(hand(0, HandType::Right)));
+    EXPECT_NE(handStateKey(hand(0, HandType::Left)), NO_HAND_KEY);
+}
+
+TEST(HandStateTable, EvictsUnseenAndRecyclesTheOldestWhenFull) {
+    HandStateTable<Counter, 2> table;
+    std::vector<uint32_t> evicted;
+    auto onEvict = [&](uint32_t key, Counter&) { evicted.push_back(key); };
+    bool isNew = false;
+    table.beginFrame();
+    table.acquire(1, isNew, onEvict).frames = 5;
+    EXPECT_TRUE(isNew);
+    table.acquire(2, isNew, onEvict).frames = 7;
+    table.beginFrame();
+    EXPECT_EQ(table.acquire(1, isNew, onEvict).frames, 5); // Same hand, same state
+    EXPECT_FALSE(isNew);
+    table.beginFrame();
+    table.acquire(1, isNew, onEvict);
+    int recycledFrames = -1;
+    EXPECT_EQ(table.acquire(3, isNew, [&](uint32_t key, Counter& state) {
+        evicted.push_back(key);
+        recycledFrames = state.frames; // Handed over before it is reset
+    }).frames, 0); // Full: takes 2's entry, seen longest ago
+    EXPECT_TRUE(isNew);
+    EXPECT_EQ(recycledFrames, 7);
+    EXPECT_EQ(table.find(2), nullptr);
+
+    table.beginFrame();
+    table.acquire(3, isNew, onEvict);
+    table.evictUnseen([](uint32_t) { return false; }, onEvict);
+    EXPECT_EQ(table.find(1), nullptr);
+    ASSERT_NE(table.find(3), nullptr);
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_EQ(evicted, (std::vector<uint32_t>{2, 1}));
+}
+
+TEST(HandStateTable, DataProcessorKeepsStatePerHandAndReportsIdChanges) {
+    DeviceAliasManager aliasMgr;
+    std::vector<std::string> events;
+    float sentX = 0.0f;
+    DataProcessor proc{aliasMgr, [&](const OscMessage& msg) {
+        if (msg.address == "/leap/dev1/right/palm/tx") sentX = msg.values[0];
+    }, nullptr, nullptr};
+    proc.setOscEventCallback([&](const OscMessage& msg) { events.push_back(msg.address); });
+    proc.setFieldMask(oscFieldBit(OscField::Gestures) | oscFieldBit(OscField::Palm));
+    PredictionConfig prediction;
+    prediction.mode = PredictionMode::ConstantVelocity;
+    prediction.toSendTime = false;
+    prediction.lookaheadMs = 10.0f;
+    proc.setPrediction(prediction);
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    auto send = [&](uint64_t t, std::vector<HandData> hands) {
+        frame.timestamp = t;
+        frame.hands = hands;
+        proc.processData(frame.deviceId, frame);
+    };
+    // Two right hands in view, moving apart at 1000 mm/s each: the outputs
+    // follow hand 1 alone, extrapolated along its own velocity.
+    send(1'000'000, { hand(1, HandType::Right, 0.0f), hand(2, HandType::Right, 500.0f) });
+    send(1'010'000, { hand(1, HandType::Right, 10.0f), hand(2, HandType::Right, 490.0f) });
+    EXPECT_NEAR(sentX, 20.0f, 1e-3f);
+    EXPECT_EQ(events, std::vector<std::string>{"/leap/dev1/right/event/enter"});
+
+    // Hand 1, which the outputs follow, is re-detected as hand 3 in one frame
+    events.clear();
+    send(1'020'000, { hand(3, HandType::Right, 20.0f), hand(2, HandType::Right, 480.0f) });
+    EXPECT_EQ(events, std::vector<std::string>{"/leap/dev1/right/event/change"});
+    send(1'030'000, { hand(3, HandType::Right, 30.0f) });
+    EXPECT_NEAR(sentX, 40.0f, 1e-3f); // Hand 3's own velocity, from its own two frames
+    EXPECT_EQ(events.size(), 1u);     // Hand 2 leaving is not the followed hand's loss
+
+    events.clear();
+    send(1'040'000, {});
+    EXPECT_EQ(events, std::vector<std::string>{"/leap/dev1/right/event/exit"});
+}
+
+TEST(HandStateTable, OnlyTheFollowedHandOfATypeIsSent) {
+    DeviceAliasManager aliasMgr;
+    std::vector<float> sent;
+    DataProcessor proc{aliasMgr, [&](const OscMessage& msg) {
+        if (msg.address == "/leap/dev1/right/pinchStrength") sent.push_back(msg.values[0]);
+    }, nullptr, nullptr};
+    std::vector<std::string> events;
+    proc.setOscEventCallback([&](const OscMessage& msg) { events.push_back(msg.address); });
+    proc.setFieldMask(oscFieldBit(OscField::Gestures) | oscFieldBit(OscField::PinchStrength));
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    auto send = [&](uint64_t t, float pinch1, float pinch2, bool withHand1 = true) {
+        frame.timestamp = t;
+        frame.hands.clear();
+        if (withHand1) {
+            frame.hands.push_back(hand(1, HandType::Right));
+            frame.hands.back().pinchStrength = pinch1;
+        }
+        frame.hands.push_back(hand(2, HandType::Right, 300.0f));
+        frame.hands.back().pinchStrength = pinch2;
+        proc.processData(frame.deviceId, frame);
+    };
+    // Hand 2 pinches while hand 1 is followed: neither its values nor its
+    // pinch reach the right hand's addresses.
+    send(1'000'000, 0.0f, 1.0f);
+    send(1'010'000, 0.0f, 0.0f);
+    EXPECT_EQ(sent, (std::vector<float>{0.0f, 0.0f}));
+    EXPECT_EQ(events, std::vector<std::string>{"/leap/dev1/right/event/enter"});
+
+    // Hand 1 pinches and leaves mid-pinch; hand 2 takes over, and the
+    // pinch it started still ends.
+    events.clear();
+    send(1'020'000, 1.0f, 0.0f);
+    send(1'030'000, 0.0f, 1.0f, false);
+    send(1'040'000, 0.0f, 0.0f, false);
+    EXPECT_EQ(events, (std::vector<std::string>{
+        "/leap/dev1/right/event/pinch/start",
+        "/leap/dev1/right/event/pinch/end", "/leap/dev1/right/event/change",
+        "/leap/dev1/right/event/pinch/start",
+        "/leap/dev1/right/event/pinch/end"}));
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "../src/core/InteractionBox.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <map>
+#include <string>
+
+namespace {
+HandData handAt(const Vector3& palm) {
+    HandData hand;
+    hand.palm.position = palm;
+    hand.arm.wristPosition = palm;
+    for (FingerData& finger : hand.fingers) finger.bones[3].nextJoint = palm;
+    return hand;
+}
+
+Vector3 normalizePalm(BoxNormalizer& normalizer, const HandData& hand) {
+    HandPointPositions points;
+    gatherHandPoints(hand, points);
+    DerivedHandData out;
+    normalizer.normalize(points, out);
+    return out.normalized[static_cast<size_t>(HandPoint::Palm)];
+}
+}
+
+TEST(InteractionBoxTest, DefaultBoxMapsToUnitRangeAndClamps) {
+    BoxNormalizer normalizer;
+    Vector3 n = normalizePalm(normalizer, handAt({0.0f, 230.0f, 0.0f}));
+    EXPECT_FLOAT_EQ(n.x, 0.5f);
+    EXPECT_FLOAT_EQ(n.y, 0.5f);
+    EXPECT_FLOAT_EQ(n.z, 0.5f);
+    n = normalizePalm(normalizer, handAt({-500.0f, 80.0f, 1000.0f}));
+    EXPECT_FLOAT_EQ(n.x, 0.0f);
+    EXPECT_FLOAT_EQ(n.y, 0.0f);
+    EXPECT_FLOAT_EQ(n.z, 1.0f);
+}
+
+TEST(InteractionBoxTest, ConfiguredBox) {
+    BoxNormalizer normalizer;
+    normalizer.configure(InteractionBox{ {0.0f, 0.0f, 0.0f}, {100.0f, 200.0f, 400.0f} }, false);
+    const Vector3 n = normalizePalm(normalizer, handAt({25.0f, 50.0f, 100.0f}));
+    EXPECT_FLOAT_EQ(n.x, 0.25f);
+    EXPECT_FLOAT_EQ(n.y, 0.25f);
+    EXPECT_FLOAT_EQ(n.z, 0.25f);
+    EXPECT_FLOAT_EQ(normalizer.size().y, 200.0f);
+}
+
+TEST(InteractionBoxTest, LearnsAxesOnceTheyAreWideEnough) {
+    BoxNormalizer normalizer;
+    normalizer.configure(InteractionBox(), true);
+    normalizePalm(normalizer, handAt({-20.0f, 200.0f, 0.0f}));
+    normalizePalm(normalizer, handAt({20.0f, 300.0f, 0.0f}));
+    // x has spanned 40 mm (default box still), y 100 mm (learned)
+    const Vector3 n = normalizePalm(normalizer, handAt({0.0f, 250.0f, 0.0f}));
+    EXPECT_FLOAT_EQ(n.x, 0.5f);
+    EXPECT_FLOAT_EQ(n.y, 0.5f);
+    EXPECT_FLOAT_EQ(normalizer.size().x, 300.0f);
+    EXPECT_FLOAT_EQ(normalizer.size().y, 100.0f);
+
+    // Invalid fingers don't widen the box
+    HandData hand = handAt({0.0f, 250.0f, 0.0f});
+    hand.fingers[1].bones[3].nextJoint = {0.0f, 1000.0f, 0.0f};
+    hand.fingers[1].bones[3].setValid(false);
+    normalizePalm(normalizer, hand);
+    EXPECT_FLOAT_EQ(normalizer.size().y, 100.0f);
+}
+
+TEST(InteractionBoxTest, DataProcessorSendsSelectedPositionForms) {
+    DeviceAliasManager aliasMgr;
+    std::map<std::string, float> sent;
+    DataProcessor proc(aliasMgr, [&](const OscMessage& msg) { sent[msg.address] = msg.values[0]; }, nullptr, nullptr);
+    proc.setFieldMask(oscFieldBit(OscField::Palm));
+    proc.setInteractionBoxes({ { "serialA", InteractionBox{ {0.0f, 0.0f, 0.0f}, {100.0f, 100.0f, 100.0f} } } }, false);
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    frame.hands.push_back(handAt({10.0f, 20.0f, 30.0f}));
+
+    proc.processData(frame.deviceId, frame);
+    EXPECT_EQ(sent.count("/leap/dev1/left/palm/norm/x"), 0u); // Raw by default
+    EXPECT_FLOAT_EQ(sent["/leap/dev1/left/palm/tx"], 10.0f);
+
+    sent.clear();
+    proc.setPositionOutput(PositionOutput::Normalized);
+    proc.processData(frame.deviceId, frame);
+    EXPECT_EQ(sent.count("/leap/dev1/left/palm/tx"), 0u);
+    EXPECT_FLOAT_EQ(sent["/leap/dev1/left/palm/norm/x"], 0.1f);
+    EXPECT_FLOAT_EQ(sent["/leap/dev1/left/palm/norm/z"], 0.3f);
+
+    sent.clear();
+    proc.setPositionOutput(PositionOutput::Both);
+    proc.processData(frame.deviceId, frame);
+    EXPECT_EQ(sent.count("/leap/dev1/left/palm/tx"), 1u);
+    EXPECT_EQ(sent.count("/leap/dev1/left/palm/norm/y"), 1u);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "../src/core/LatestFrameStore.hpp"
+#include <thread>
+#include <atomic>
+
+namespace {
+FrameData makeFrame(const std::string& deviceId, uint64_t timestamp, size_t handCount) {
+    FrameData frame;
+    frame.deviceId = deviceId;
+    frame.timestamp = timestamp;
+    frame.hands.resize(handCount);
+    for (size_t i = 0; i < handCount; ++i) {
+        frame.hands[i].handType = (i % 2 == 0) ? HandType::Left : HandType::Right;
+        frame.hands[i].palm.position = {static_cast<float>(timestamp), static_cast<float>(i), 0.0f};
+        frame.hands[i].fingers[4].bones[3].nextJoint.z = static_cast<float>(timestamp);
+    }
+    return frame;
+}
+}
+
+TEST(LatestFrameStoreTest, EmptyStoreHasNoFrame) {
+    LatestFrameStore store;
+    FrameData out;
+    EXPECT_FALSE(store.getLatest(out));
+    EXPECT_FALSE(store.getLatest("LPM000000001", out));
+}
+
+TEST(LatestFrameStoreTest, KeepsLatestFramePerDevice) {
+    LatestFrameStore store;
+    store.publish(makeFrame("LPM000000001", 10, 1));
+    store.publish(makeFrame("LPM000000002", 20, 2));
+    store.publish(makeFrame("LPM000000001", 11, 2));
+    EXPECT_EQ(store.deviceCount(), 2u);
+
+    FrameData out;
+    ASSERT_TRUE(store.getLatest("LPM000000001", out));
+    EXPECT_EQ(out.deviceId, "LPM000000001");
+    EXPECT_EQ(out.timestamp, 11u);
+    ASSERT_EQ(out.hands.size(), 2u);
+    EXPECT_EQ(out.hands[1].handType, HandType::Right);
+    EXPECT_FLOAT_EQ(out.hands[1].palm.position.y, 1.0f);
+
+    ASSERT_TRUE(store.getLatest("LPM000000002", out));
+    EXPECT_EQ(out.timestamp, 20u);
+
+    // getNextFrame semantics: whichever device published last
+    ASSERT_TRUE(store.getLatest(out));
+    EXPECT_EQ(out.deviceId, "LPM000000001");
+    EXPECT_EQ(out.timestamp, 11u);
+
+    EXPECT_FALSE(store.getLatest("LPM000000003", out));
+}
+
+TEST(LatestFrameStoreTest, StopsAddingDevicesAtCapacity) {
+    LatestFrameStore store;
+    for (size_t i = 0; i < MAX_TRACKED_DEVICES; ++i) {
+        EXPECT_TRUE(store.publish(makeFrame("dev" + std::to_string(i), i, 1)));
+    }
+    EXPECT_FALSE(store.publish(makeFrame("one-too-many", 1, 1)));
+    EXPECT_TRUE(store.publish(makeFrame("dev0", 99, 1))); // Existing devices keep updating
+    EXPECT_EQ(store.deviceCount(), MAX_TRACKED_DEVICES);
+}
+
+TEST(LatestFrameStoreTest, ReadersNeverSeeTornFrames) {
+    LatestFrameStore store;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&]() {
+        FrameData frame;
+        for (uint64_t t = 1; t <= 200000; ++t) {
+            frame = makeFrame("LPM000000001", t, 1 + t % 2);
+            store.publish(frame);
+        }
+        done = true;
+    });
+
+    size_t reads = 0;
+    bool consistent = true;
+    uint64_t lastSeen = 0;
+    FrameData out;
+    while (!done) {
+        if (!store.getLatest("LPM000000001", out)) continue;
+        ++reads;
+        // Every field of one frame is derived from its timestamp
+        if (out.hands.size() != 1 + out.timestamp % 2) consistent = false;
+        for (const HandData& hand : out.hands) {
+            if (hand.palm.position.x != static_cast<float>(out.timestamp)) consistent = false;
+            if (hand.fingers[4].bones[3].nextJoint.z != static_cast<float>(out.timestamp)) consistent = false;
+        }
+        if (out.timestamp < lastSeen) consistent = false; // Never goes backwards
+        lastSeen = out.timestamp;
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_GT(reads, 0u);
+}
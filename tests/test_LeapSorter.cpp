@@ -2,13 +2,15 @@
 #include "../src/pipeline/02_LeapSorter.hpp"
 #include <vector>
 #include <string>
+#include <thread>
+#include <atomic>
 
 TEST(LeapSorterTest, CallsCallbackForEachDevice) {
     using CallbackRecord = std::pair<std::string, FrameData>;
     std::vector<CallbackRecord> callbackResults;
 
     // Mock callback that records serial and frame
-    auto callback = [&callbackResults](const std::string& serial, const FrameData& frame) {
+    auto callback = [&callbackResults](const std::string& serial, const FrameData& frame, HandMask) {
         callbackResults.emplace_back(serial, frame);
     };
 
@@ -29,3 +31,80 @@ TEST(LeapSorterTest, CallsCallbackForEachDevice) {
     EXPECT_EQ(callbackResults[1].first, "serialB");
     EXPECT_EQ(callbackResults[1].second.timestamp, 456);
 }
+
+namespace {
+FrameData makeTwoHandFrame(const std::string& deviceId, uint8_t slot) {
+    FrameData frame;
+    frame.deviceId = deviceId;
+    frame.deviceSlot = slot;
+    frame.hands.resize(2);
+    frame.hands[0].handType = HandType::Left;
+    frame.hands[1].handType = HandType::Right;
+    return frame;
+}
+}
+
+TEST(LeapSorterTest, FiltersHandsByAssignmentUsingDeviceSlots) {
+    std::vector<HandMask> masks;
+    LeapSorter sorter([&](const std::string&, const FrameData&, HandMask hands) { masks.push_back(hands); });
+
+    DeviceSlotTable slots;
+    sorter.setDeviceSlots(&slots);
+    sorter.setDeviceHand("serialA", "RIGHT"); // Assigned before the device has a slot
+
+    const uint8_t slotA = slots.findOrAssign("serialA");
+    const uint8_t slotB = slots.findOrAssign("serialB");
+    sorter.processFrame("serialA", makeTwoHandFrame("serialA", slotA));
+    sorter.processFrame("serialB", makeTwoHandFrame("serialB", slotB));
+
+    sorter.setDeviceHand("serialB", "left");
+    sorter.processFrame("serialB", makeTwoHandFrame("serialB", slotB));
+    sorter.setDeviceHand("serialB", "NONE");
+    sorter.processFrame("serialB", makeTwoHandFrame("serialB", slotB));
+
+    // Bit 0 is the left hand, bit 1 the right hand of makeTwoHandFrame()
+    EXPECT_EQ(masks, (std::vector<HandMask>{0b10, 0b11, 0b01, 0b11}));
+}
+
+TEST(LeapSorterTest, FramesWithoutSlotFallBackToSerialLookup) {
+    HandMask lastMask = 0;
+    LeapSorter sorter([&](const std::string&, const FrameData&, HandMask hands) { lastMask = hands; });
+    sorter.setDeviceHand("serialA", "LEFT");
+    sorter.processFrame("serialA", makeTwoHandFrame("serialA", INVALID_DEVICE_SLOT));
+    EXPECT_EQ(lastMask, 0b01u);
+}
+
+TEST(LeapSorterTest, AssignmentChangesWhileProcessingAreSafe) {
+    std::atomic<bool> done{false};
+    size_t frames = 0;
+    bool sawOnlyValidCounts = true;
+    LeapSorter sorter([&](const std::string&, const FrameData&, HandMask hands) {
+        ++frames;
+        if (hands != 0b01 && hands != 0b10 && hands != 0b11) sawOnlyValidCounts = false;
+    });
+    DeviceSlotTable slots;
+    sorter.setDeviceSlots(&slots);
+    const uint8_t slot = slots.findOrAssign("serialA");
+
+    std::thread ui([&]() {
+        const char* hands[] = { "LEFT", "RIGHT", "NONE" };
+        for (int i = 0; i < 2000; ++i) sorter.setDeviceHand("serialA", hands[i % 3]);
+        done = true;
+    });
+    FrameData frame = makeTwoHandFrame("serialA", slot);
+    while (!done) sorter.processFrame("serialA", frame);
+    ui.join();
+
+    EXPECT_GT(frames, 0u);
+    EXPECT_TRUE(sawOnlyValidCounts);
+}
+
+TEST(LeapSorterTest, PassesOriginalFrameWithoutCopying) {
+    const FrameData* seen = nullptr;
+    LeapSorter sorter([&](const std::string&, const FrameData& frame, HandMask) { seen = &frame; });
+    sorter.setDeviceHand("serialA", "RIGHT");
+    const FrameData frame = makeTwoHandFrame("serialA", INVALID_DEVICE_SLOT);
+    sorter.processFrame("serialA", frame);
+    EXPECT_EQ(seen, &frame);
+    EXPECT_EQ(frame.hands.size(), 2u);
+}
@@ -67,13 +67,9 @@ TEST_F(MainAppWindowTest_FRIEND, OscFilterToggles) {
     OscController oscController(mockSink, configManager); // Pass dependencies
 
     // Set default values (optional, but good practice)
-    configManager.setSendPalmEnabled(true);
-    configManager.setSendThumbEnabled(true);
-    // Set other fingers true initially if needed, e.g.:
-    configManager.setSendIndexEnabled(true);
-    configManager.setSendMiddleEnabled(true);
-    configManager.setSendRingEnabled(true);
-    configManager.setSendPinkyEnabled(true);
+    const OscFieldMask palmAndFingers = oscFieldBit(OscField::Palm) | oscFieldBit(OscField::Thumb) |
+        oscFieldBit(OscField::Index) | oscFieldBit(OscField::Middle) | oscFieldBit(OscField::Ring) | oscFieldBit(OscField::Pinky);
+    configManager.setOscFieldMask(configManager.getOscFieldMask() | palmAndFingers);
 
     MainAppWindow app(
         [](const FrameData&){},          // Use real FrameData
@@ -89,13 +85,7 @@ TEST_F(MainAppWindowTest_FRIEND, OscFilterToggles) {
     app.setControllers(&configManager, &oscController);
 
     // Toggle OSC filter flags using ConfigManager
-    configManager.setSendPalmEnabled(false);
-    configManager.setSendThumbEnabled(false);
-    // Explicitly set all finger flags to false
-    configManager.setSendIndexEnabled(false);
-    configManager.setSendMiddleEnabled(false);
-    configManager.setSendRingEnabled(false);
-    configManager.setSendPinkyEnabled(false);
+    configManager.setOscFieldMask(configManager.getOscFieldMask() & ~palmAndFingers);
 
     // Check flags using OscController getters
     EXPECT_FALSE(oscController.getSendPalmFlag());
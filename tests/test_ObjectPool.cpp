@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "../src/utils/ObjectPool.h"
+#include "../src/core/FrameData.hpp"
+#include <thread>
+#include <atomic>
+#include <set>
+#include <vector>
+
+TEST(ObjectPoolTest, AcquireFailsWhenAllObjectsInFlight) {
+    ObjectPool<int> pool(2);
+    int* a = pool.acquire();
+    int* b = pool.acquire();
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.acquire(), nullptr);
+
+    pool.publish(a);
+    pool.publish(b);
+    EXPECT_EQ(pool.acquire(), nullptr); // Published but not yet released
+
+    int* received = pool.receive();
+    EXPECT_EQ(received, a); // Published order is preserved
+    pool.release(received);
+    EXPECT_EQ(pool.acquire(), a);
+}
+
+TEST(ObjectPoolTest, ReceiveIsEmptyUntilPublished) {
+    ObjectPool<int> pool(4);
+    EXPECT_EQ(pool.receive(), nullptr);
+    int* a = pool.acquire();
+    *a = 42;
+    pool.publish(a);
+    EXPECT_EQ(pool.pending_approx(), 1u);
+    int* received = pool.receive();
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(*received, 42);
+    EXPECT_EQ(pool.receive(), nullptr);
+}
+
+TEST(ObjectPoolTest, RecycledFramesKeepTheirStorageAcrossThreads) {
+    constexpr size_t kPoolSize = 8;
+    constexpr int kFrames = 20000;
+    ObjectPool<FrameData> pool(kPoolSize, [](FrameData& frame) { frame.hands.reserve(4); });
+
+    // Record where each pooled frame keeps its hands; copy-assigning at most
+    // four hands into a recycled frame must never move that storage.
+    std::set<const HandData*> storage;
+    for (size_t i = 0; i < kPoolSize; ++i) {
+        FrameData* frame = pool.acquire();
+        storage.insert(frame->hands.data());
+        pool.publish(frame);
+    }
+    while (FrameData* frame = pool.receive()) pool.release(frame);
+    ASSERT_EQ(storage.size(), kPoolSize);
+
+    std::atomic<bool> producerDone{false};
+    std::thread producer([&]() {
+        FrameData source;
+        source.deviceId = "LPM000000001";
+        for (int i = 0; i < kFrames; ) {
+            source.timestamp = i;
+            source.hands.resize(1 + i % 2);
+            FrameData* frame = pool.acquire();
+            if (!frame) { std::this_thread::yield(); continue; }
+            *frame = source;
+            pool.publish(frame);
+            ++i;
+        }
+        producerDone = true;
+    });
+
+    int received = 0;
+    int64_t lastTimestamp = -1;
+    bool inOrder = true;
+    bool storageReused = true;
+    while (received < kFrames) {
+        FrameData* frame = pool.receive();
+        if (!frame) {
+            if (producerDone && pool.pending_approx() == 0) break;
+            std::this_thread::yield();
+            continue;
+        }
+        if (frame->timestamp != static_cast<uint64_t>(lastTimestamp + 1)) inOrder = false;
+        if (!storage.count(frame->hands.data())) storageReused = false;
+        lastTimestamp = static_cast<int64_t>(frame->timestamp);
+        pool.release(frame);
+        ++received;
+    }
+    producer.join();
+
+    EXPECT_EQ(received, kFrames);
+    EXPECT_TRUE(inOrder);
+    EXPECT_TRUE(storageReused);
+}
+
+TEST(ObjectPoolTest, ReclaimOldestTakesBackUnreceivedObjects) {
+    ObjectPool<int> pool(3);
+    for (int value = 1; value <= 3; ++value) {
+        int* object = pool.acquire();
+        *object = value;
+        pool.publish(object);
+    }
+    ASSERT_EQ(pool.acquire(), nullptr);
+
+    int* reclaimed = pool.reclaimOldest();
+    ASSERT_NE(reclaimed, nullptr);
+    EXPECT_EQ(*reclaimed, 1);
+    *reclaimed = 4;
+    pool.publish(reclaimed);
+
+    std::vector<int> received;
+    while (int* object = pool.receive()) {
+        received.push_back(*object);
+        pool.release(object);
+    }
+    EXPECT_EQ(received, (std::vector<int>{2, 3, 4}));
+    EXPECT_EQ(pool.reclaimOldest(), nullptr);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "../src/core/OscFieldRegistry.hpp"
+#include <algorithm>
+#include <set>
+#include <string>
+
+namespace {
+size_t channelId(const std::string& address) {
+    const auto& channels = oscChannels();
+    auto it = std::find_if(channels.begin(), channels.end(), [&](const OscChannel& c) { return c.address == address; });
+    return it == channels.end() ? SIZE_MAX : static_cast<size_t>(it - channels.begin());
+}
+
+bool isLive(const OscEmissionPlan& plan, size_t id) {
+    return std::any_of(plan.live.begin(), plan.live.end(), [&](const OscEmission& e) { return e.addressId == id; });
+}
+}
+
+TEST(OscFieldRegistryTest, FieldsAreIndexedByEnumWithUniqueKeys) {
+    std::set<std::string> keys;
+    for (size_t i = 0; i < OSC_FIELD_COUNT; ++i) {
+        EXPECT_EQ(static_cast<size_t>(oscFields()[i].field), i);
+        EXPECT_TRUE(keys.insert(oscFields()[i].configKey).second);
+    }
+    const OscFieldMask defaults = defaultOscFieldMask();
+    EXPECT_TRUE(defaults & oscFieldBit(OscField::Palm));
+    EXPECT_FALSE(defaults & oscFieldBit(OscField::PalmVelocity));
+}
+
+TEST(OscFieldRegistryTest, ChannelsReadTheirSourceFields) {
+    HandData hand;
+    hand.palm.position = {1.0f, 2.0f, 3.0f};
+    hand.palm.orientation = {0.5f, 0.1f, 0.2f, 0.3f};
+    hand.fingers[2].bones[3].nextJoint = {7.0f, 8.0f, 9.0f};
+    hand.fingers[4].isExtended = true;
+    hand.visibleTime = 2'500'000;
+    DerivedHandData derived;
+    derived.cursor[static_cast<size_t>(HandPoint::Index)] = {0.1f, 0.2f, 0.3f};
+
+    const OscEmissionPlan plan = compileEmissionPlan(~OscFieldMask(0));
+    auto valueOf = [&](const std::string& address) {
+        const size_t id = channelId(address);
+        for (const OscEmission& e : plan.live) {
+            if (e.addressId == id) return readChannelValue(hand, derived, e);
+        }
+        ADD_FAILURE() << "no live channel " << address;
+        return -1.0f;
+    };
+    EXPECT_FLOAT_EQ(valueOf("palm/ty"), 2.0f);
+    EXPECT_FLOAT_EQ(valueOf("palm/orientation/qw"), 0.5f);
+    EXPECT_FLOAT_EQ(valueOf("palm/orientation/qz"), 0.3f);
+    EXPECT_FLOAT_EQ(valueOf("finger/middle/tz"), 9.0f);
+    EXPECT_FLOAT_EQ(valueOf("finger/pinky/isExtended"), 1.0f);
+    EXPECT_FLOAT_EQ(valueOf("finger/thumb/isExtended"), 0.0f);
+    EXPECT_FLOAT_EQ(valueOf("visibleTime"), 2.5f);
+    EXPECT_FLOAT_EQ(valueOf("finger/index/cursor/y"), 0.2f);
+}
+
+TEST(OscFieldRegistryTest, PlanContainsOnlyEnabledFields) {
+    const OscEmissionPlan plan = compileEmissionPlan(oscFieldBit(OscField::Thumb) | oscFieldBit(OscField::PalmVelocity));
+    EXPECT_TRUE(isLive(plan, channelId("finger/thumb/tx")));
+    EXPECT_TRUE(isLive(plan, channelId("palm/velocity/vz")));
+    EXPECT_FALSE(isLive(plan, channelId("palm/tx")));
+    EXPECT_FALSE(isLive(plan, channelId("finger/index/tx")));
+    // "exists" is only ever sent as a zero when the hand is lost
+    EXPECT_FALSE(isLive(plan, channelId("finger/thumb/exists")));
+    EXPECT_EQ(std::count(plan.zeroOnLoss.begin(), plan.zeroOnLoss.end(), channelId("finger/thumb/exists")), 1);
+    // Velocity is not zeroed on hand loss
+    EXPECT_EQ(std::count(plan.zeroOnLoss.begin(), plan.zeroOnLoss.end(), channelId("palm/velocity/vz")), 0);
+
+    EXPECT_TRUE(compileEmissionPlan(0).live.empty());
+}
+
+TEST(OscFieldRegistryTest, InvalidArmAndFingersFailTheirGuards) {
+    HandData hand;
+    hand.arm.setValid(false);
+    hand.fingers[1].bones[3].setValid(false);
+    const uint32_t valid = handValidity(hand);
+    EXPECT_FALSE(valid & (1u << OSC_GUARD_ARM));
+    EXPECT_TRUE(valid & (1u << OSC_GUARD_FINGER));
+    EXPECT_FALSE(valid & (1u << (OSC_GUARD_FINGER + 1)));
+    EXPECT_EQ(oscChannels()[channelId("wrist/tx")].guard, OSC_GUARD_ARM);
+    EXPECT_EQ(oscChannels()[channelId("finger/index/ty")].guard, OSC_GUARD_FINGER + 1);
+}
+
+TEST(OscFieldRegistryTest, CursorsFollowTheirPointFields) {
+    const OscEmissionPlan plan = compileEmissionPlan(oscFieldBit(OscField::Cursor) | oscFieldBit(OscField::Thumb));
+    EXPECT_TRUE(isLive(plan, channelId("finger/thumb/cursor/x")));
+    EXPECT_FALSE(isLive(plan, channelId("finger/index/cursor/x")));
+    EXPECT_FALSE(isLive(plan, channelId("palm/cursor/x")));
+    EXPECT_FALSE(isLive(compileEmissionPlan(oscFieldBit(OscField::Thumb)), channelId("finger/thumb/cursor/x")));
+    // Cursors hold their position while the hand is away
+    EXPECT_EQ(std::count(plan.zeroOnLoss.begin(), plan.zeroOnLoss.end(), channelId("finger/thumb/cursor/x")), 0);
+}
+
+TEST(OscFieldRegistryTest, PositionOutputSelectsRawOrNormalized) {
+    const OscFieldMask fields = oscFieldBit(OscField::Palm);
+    const OscEmissionPlan raw = compileEmissionPlan(fields);
+    EXPECT_TRUE(isLive(raw, channelId("palm/tx")));
+    EXPECT_FALSE(isLive(raw, channelId("palm/norm/x")));
+
+    const OscEmissionPlan normalized = compileEmissionPlan(fields, PositionOutput::Normalized);
+    EXPECT_FALSE(isLive(normalized, channelId("palm/tx")));
+    EXPECT_TRUE(isLive(normalized, channelId("palm/norm/x")));
+    EXPECT_EQ(std::count(normalized.zeroOnLoss.begin(), normalized.zeroOnLoss.end(), channelId("palm/norm/x")), 1);
+
+    const OscEmissionPlan both = compileEmissionPlan(fields, PositionOutput::Both);
+    EXPECT_TRUE(isLive(both, channelId("palm/tx")));
+    EXPECT_TRUE(isLive(both, channelId("palm/norm/z")));
+    // Other fields don't depend on the position form
+    EXPECT_TRUE(isLive(compileEmissionPlan(oscFieldBit(OscField::PalmVelocity), PositionOutput::Normalized), channelId("palm/velocity/vx")));
+}
@@ -146,3 +146,22 @@ TEST(OscSenderTest, SendBundle) {
     ASSERT_TRUE(pkt.find("/b1") != std::string::npos || pkt.find("/b2") != std::string::npos);
     receiver.stop();
 }
+
+TEST(OscSenderTest, SendOscBundleAsOnePacket) {
+    int testPort = 9005;
+    UdpReceiver receiver(testPort);
+    receiver.start();
+    OscSender sender("127.0.0.1", testPort);
+    OscBundle bundle;
+    bundle.messages = {
+        {"/zero/1", {0.0f}},
+        {"/zero/2", {0.0f}}
+    };
+    sender.sendOscBundle(bundle);
+    std::string pkt;
+    ASSERT_TRUE(receiver.waitForPacket(pkt));
+    EXPECT_EQ(pkt.compare(0, 7, "#bundle"), 0);
+    EXPECT_NE(pkt.find("/zero/1"), std::string::npos);
+    EXPECT_NE(pkt.find("/zero/2"), std::string::npos);
+    receiver.stop();
+}
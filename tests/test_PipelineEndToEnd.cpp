@@ -27,18 +27,18 @@ TEST(PipelineEndToEnd, FrameToOscMessage) {
             for (float v : msg.values)
                 oscSender.sendMessage(msg.address, v);
         },
-        [](const FrameData&) {},
+        [](const FrameData&, HandMask) {},
         logger
     );
 
     // Enable palm data only
-    processor.setFilterSettings(true, false, false, false, false, false, false, false, false, false, false, false, true, true);
+    processor.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::PinchStrength) | oscFieldBit(OscField::GrabStrength));
 
     // Create synthetic FrameData
     FrameData frame;
     frame.deviceId = "serialA";
     HandData hand;
-    hand.handType = "left";
+    hand.handType = HandType::Left;
     hand.palm.position = {1, 2, 3};
     frame.hands.push_back(hand);
 
@@ -63,21 +63,21 @@ TEST(PipelineEndToEnd, MultiDeviceFrameToOscMessage) {
             // Prefix serial to address for test verification
             oscSender.sendMessage(msg.address, msg.values.empty() ? 0.0f : msg.values[0]);
         },
-        [](const FrameData&) {},
+        [](const FrameData&, HandMask) {},
         logger2
     );
-    processor.setFilterSettings(true, false, false, false, false, false, false, false, false, false, false, true, true, true);
+    processor.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::FingerIsExtended) | oscFieldBit(OscField::PinchStrength) | oscFieldBit(OscField::GrabStrength));
 
     // Device 1
     FrameData frame1;
     frame1.deviceId = "serialA";
-    HandData hand1; hand1.handType = "left"; hand1.palm.position = {1, 2, 3};
+    HandData hand1; hand1.handType = HandType::Left; hand1.palm.position = {1, 2, 3};
     frame1.hands.push_back(hand1);
 
     // Device 2
     FrameData frame2;
     frame2.deviceId = "serialB";
-    HandData hand2; hand2.handType = "right"; hand2.palm.position = {4, 5, 6};
+    HandData hand2; hand2.handType = HandType::Right; hand2.palm.position = {4, 5, 6};
     frame2.hands.push_back(hand2);
 
     processor.processData("serialA", frame1);
@@ -92,3 +92,30 @@ TEST(PipelineEndToEnd, MultiDeviceFrameToOscMessage) {
     EXPECT_TRUE(foundA);
     EXPECT_TRUE(foundB);
 }
+
+// LeapSorter's hand mask decides which hands are emitted; unselected hands are skipped
+TEST(PipelineEndToEnd, HandMaskSelectsEmittedHands) {
+    DeviceAliasManager aliasMgr;
+    MockOscSender oscSender;
+    DataProcessor processor(
+        aliasMgr,
+        [&](const OscMessage& msg) { oscSender.sendMessage(msg.address, msg.values.empty() ? 0.0f : msg.values[0]); },
+        [](const FrameData&, HandMask) {},
+        nullptr
+    );
+    processor.setFieldMask(oscFieldBit(OscField::Palm));
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    HandData left; left.handType = HandType::Left;
+    HandData right; right.handType = HandType::Right;
+    frame.hands.push_back(left);
+    frame.hands.push_back(right);
+
+    processor.processData("serialA", frame, handBit(1));
+
+    ASSERT_EQ(oscSender.sentAddresses.size(), 3u);
+    for (const auto& addr : oscSender.sentAddresses) {
+        EXPECT_EQ(addr.rfind("/leap/dev1/right/", 0), 0u) << addr;
+    }
+}
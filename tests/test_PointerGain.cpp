@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "../src/core/PointerGain.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <map>
+#include <string>
+
+namespace {
+const Vector3 RANGE = {300.0f, 300.0f, 240.0f};
+constexpr uint64_t FRAME_US = 10'000;
+
+HandData handAt(float x, float palmSpeed = 0.0f) {
+    HandData hand;
+    hand.palm.position = {x, 200.0f, 0.0f};
+    hand.palm.velocity = {palmSpeed, 0.0f, 0.0f};
+    for (FingerData& finger : hand.fingers) finger.bones[3].nextJoint = {x, 250.0f, 0.0f};
+    return hand;
+}
+
+void apply(PointerGain& gain, const HandData& hand, uint64_t timestampUs, const GainCurve& curve,
+           const Vector3& range, DerivedHandData& out) {
+    HandPointPositions points;
+    gatherHandPoints(hand, points);
+    gain.apply(hand, points, timestampUs, curve, range, out);
+}
+
+float palmX(const DerivedHandData& derived) { return derived.cursor[static_cast<size_t>(HandPoint::Palm)].x; }
+}
+
+TEST(PointerGainTest, CurveIsPiecewiseLinearInSpeed) {
+    GainCurve curve; // 1 / 3 / 6 at 80 and 240 mm/s
+    EXPECT_FLOAT_EQ(curve.gainAt(0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(curve.gainAt(80.0f), 1.0f);
+    EXPECT_FLOAT_EQ(curve.gainAt(160.0f), 2.0f);
+    EXPECT_FLOAT_EQ(curve.gainAt(240.0f), 3.0f);
+    EXPECT_FLOAT_EQ(curve.gainAt(360.0f), 4.5f);
+    EXPECT_FLOAT_EQ(curve.gainAt(10'000.0f), 6.0f);
+}
+
+TEST(PointerGainTest, CursorMovesByGainTimesDelta) {
+    GainCurve curve;
+    PointerGain gain;
+    DerivedHandData out;
+    apply(gain, handAt(0.0f), FRAME_US, curve, RANGE, out);
+    EXPECT_FLOAT_EQ(palmX(out), 0.5f); // Starts centred, first frame has no delta
+
+    apply(gain, handAt(3.0f, 50.0f), 2 * FRAME_US, curve, RANGE, out); // Slow: base gain
+    EXPECT_NEAR(palmX(out), 0.5f + 3.0f / 300.0f, 1e-6f);
+
+    apply(gain, handAt(6.0f, 1000.0f), 3 * FRAME_US, curve, RANGE, out); // Fast: max gain
+    EXPECT_NEAR(palmX(out), 0.5f + 3.0f / 300.0f + 6.0f * 3.0f / 300.0f, 1e-6f);
+}
+
+TEST(PointerGainTest, PointsSourceUsesEachPointsOwnSpeed) {
+    GainCurve curve;
+    curve.velocitySource = GainVelocitySource::Points;
+    PointerGain gain;
+    DerivedHandData out;
+    HandData hand = handAt(0.0f);
+    apply(gain, hand, FRAME_US, curve, RANGE, out);
+    hand.fingers[1].bones[3].nextJoint.x = 10.0f; // 1000 mm/s; everything else still
+    apply(gain, hand, 2 * FRAME_US, curve, RANGE, out);
+    EXPECT_NEAR(out.cursor[static_cast<size_t>(HandPoint::Index)].x, 0.5f + 6.0f * 10.0f / 300.0f, 1e-6f);
+    EXPECT_FLOAT_EQ(palmX(out), 0.5f);
+}
+
+TEST(PointerGainTest, ClampsAndKeepsCursorAcrossReset) {
+    GainCurve curve;
+    PointerGain gain;
+    DerivedHandData out;
+    apply(gain, handAt(0.0f), FRAME_US, curve, RANGE, out);
+    apply(gain, handAt(-1000.0f), 2 * FRAME_US, curve, RANGE, out);
+    EXPECT_FLOAT_EQ(palmX(out), 0.0f);
+
+    gain.reset();
+    apply(gain, handAt(500.0f), 3 * FRAME_US, curve, RANGE, out); // Re-entry: no jump
+    EXPECT_FLOAT_EQ(palmX(out), 0.0f);
+    apply(gain, handAt(530.0f), 4 * FRAME_US, curve, RANGE, out);
+    EXPECT_NEAR(palmX(out), 0.1f, 1e-6f);
+}
+
+TEST(PointerGainTest, InvalidPointsHoldTheirCursor) {
+    GainCurve curve;
+    PointerGain gain;
+    DerivedHandData out;
+    HandData hand = handAt(0.0f);
+    apply(gain, hand, FRAME_US, curve, RANGE, out);
+    hand = handAt(30.0f);
+    hand.fingers[0].bones[3].setValid(false);
+    apply(gain, hand, 2 * FRAME_US, curve, RANGE, out);
+    hand = handAt(60.0f);
+    apply(gain, hand, 3 * FRAME_US, curve, RANGE, out); // Valid again: restarts from here
+    EXPECT_FLOAT_EQ(out.cursor[static_cast<size_t>(HandPoint::Thumb)].x, 0.5f);
+    EXPECT_NEAR(out.cursor[static_cast<size_t>(HandPoint::Index)].x, 0.7f, 1e-6f);
+}
+
+TEST(PointerGainTest, DataProcessorSendsCursorsForEnabledPoints) {
+    DeviceAliasManager aliasMgr;
+    std::map<std::string, float> sent;
+    DataProcessor proc(aliasMgr, [&](const OscMessage& msg) { sent[msg.address] = msg.values[0]; }, nullptr, nullptr);
+    proc.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::Cursor));
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    frame.timestamp = FRAME_US;
+    frame.hands.push_back(handAt(0.0f));
+    proc.processData(frame.deviceId, frame);
+    frame.timestamp = 2 * FRAME_US;
+    frame.hands[0] = handAt(30.0f);
+    proc.processData(frame.deviceId, frame);
+
+    EXPECT_NEAR(sent["/leap/dev1/left/palm/cursor/x"], 0.6f, 1e-6f);
+    EXPECT_FLOAT_EQ(sent["/leap/dev1/left/palm/cursor/y"], 0.5f);
+    EXPECT_EQ(sent.count("/leap/dev1/left/finger/index/cursor/x"), 0u);
+}
+
+TEST(PointerGainTest, DataProcessorKeepsCursorsAcrossHandLossAndNewIds) {
+    DeviceAliasManager aliasMgr;
+    std::map<std::string, float> sent;
+    DataProcessor proc(aliasMgr, [&](const OscMessage& msg) { sent[msg.address] = msg.values[0]; }, nullptr, nullptr);
+    proc.setFieldMask(oscFieldBit(OscField::Palm) | oscFieldBit(OscField::Cursor));
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    auto send = [&](uint64_t frameIndex, std::vector<HandData> hands) {
+        frame.timestamp = frameIndex * FRAME_US;
+        frame.hands = hands;
+        proc.processData(frame.deviceId, frame);
+    };
+    auto withId = [](HandData hand, uint32_t id) { hand.id = id; return hand; };
+    send(1, { withId(handAt(0.0f), 1) });
+    send(2, { withId(handAt(30.0f), 1) });
+    ASSERT_NEAR(sent["/leap/dev1/left/palm/cursor/x"], 0.6f, 1e-6f);
+
+    // The hand leaves and comes back under a new id, elsewhere: the cursor
+    // resumes where it was, and only moves with the new hand's own motion.
+    send(3, {});
+    send(4, { withId(handAt(-200.0f), 2) });
+    EXPECT_NEAR(sent["/leap/dev1/left/palm/cursor/x"], 0.6f, 1e-6f);
+    send(5, { withId(handAt(-170.0f), 2) });
+    EXPECT_NEAR(sent["/leap/dev1/left/palm/cursor/x"], 0.7f, 1e-6f);
+}
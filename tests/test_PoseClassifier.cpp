@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "../src/core/PoseClassifier.hpp"
+#include "../src/core/HandFeatures.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+PoseFeatures featuresWith(float value, size_t index = 0) {
+    PoseFeatures features;
+    features.values[index] = value;
+    return features;
+}
+
+// Flat hand, fingers along -z, scaled by `scale`, with the index finger
+// curled at its PIP when curled is set
+HandData hand(float scale, bool curled) {
+    HandData h;
+    h.palm.normal = {0.0f, -1.0f, 0.0f};
+    h.palm.position = {0.0f, 200.0f * scale, 30.0f * scale};
+    for (size_t f = 0; f < 5; ++f) {
+        Vector3 joint = { (static_cast<float>(f) - 2.0f) * 20.0f * scale, 200.0f * scale, 60.0f * scale };
+        for (size_t b = 0; b < 4; ++b) {
+            BoneData& bone = h.fingers[f].bones[b];
+            bone.prevJoint = joint;
+            if (curled && f == 1 && b >= 2) joint.y -= 25.0f * scale;
+            else joint.z -= 25.0f * scale;
+            bone.nextJoint = joint;
+        }
+    }
+    return h;
+}
+
+PoseFeatures poseOf(const HandData& h) {
+    DerivedHandData derived;
+    computeHandFeatures(h, derived);
+    PoseFeatures features;
+    buildPoseFeatures(h, derived, features);
+    return features;
+}
+}
+
+TEST(PoseClassifierTest, NearestPoseWithScore) {
+    PoseLibrary library({ PoseTemplate{ 1, "a", { featuresWith(0.0f), featuresWith(0.1f) } },
+                          PoseTemplate{ 2, "b", { featuresWith(1.0f) } } });
+    EXPECT_EQ(library.sampleCount(), 3u);
+    PoseMatchConfig config;
+    config.maxDistance = 0.5f;
+
+    PoseMatch match = library.classify(featuresWith(0.1f), config);
+    EXPECT_EQ(match.id, 1);
+    EXPECT_FLOAT_EQ(match.score, 1.0f);
+
+    match = library.classify(featuresWith(0.9f), config);
+    EXPECT_EQ(match.id, 2);
+    EXPECT_GT(match.score, 0.5f);
+    EXPECT_LT(match.score, 1.0f);
+}
+
+TEST(PoseClassifierTest, RejectsFarAndAmbiguousMatches) {
+    PoseLibrary library({ PoseTemplate{ 1, "a", { featuresWith(0.0f) } }, PoseTemplate{ 2, "b", { featuresWith(1.0f) } } });
+    PoseMatchConfig config;
+    config.maxDistance = 1.0f;
+    config.minMargin = 0.2f;
+    EXPECT_EQ(library.classify(featuresWith(0.5f), config).id, 0);  // Halfway: no margin
+    EXPECT_EQ(library.classify(featuresWith(0.3f), config).id, 1);  // 0.3 vs 0.7
+
+    config.maxDistance = 0.01f;
+    EXPECT_EQ(library.classify(featuresWith(0.3f), config).id, 0);  // Too far from everything
+    EXPECT_EQ(PoseLibrary().classify(featuresWith(0.0f), config).id, 0);
+}
+
+TEST(PoseClassifierTest, FeaturesIgnoreHandSize) {
+    const PoseFeatures small = poseOf(hand(1.0f, false));
+    const PoseFeatures large = poseOf(hand(1.5f, false));
+    for (size_t i = 0; i < POSE_FEATURE_COUNT; ++i) EXPECT_NEAR(small.values[i], large.values[i], 1e-4f) << i;
+    EXPECT_NEAR(poseOf(hand(1.0f, true)).values[4], 0.5f, 1e-4f); // Index PIP bent 90 degrees
+}
+
+TEST(PoseClassifierTest, DataProcessorSendsPoseIdAndScore) {
+    DeviceAliasManager aliasMgr;
+    std::vector<OscMessage> sent;
+    DataProcessor proc{aliasMgr, [&](const OscMessage& msg) { sent.push_back(msg); }, nullptr, nullptr};
+    proc.setFieldMask(oscFieldBit(OscField::Pose));
+    proc.setPoses({ PoseTemplate{ 3, "open", { poseOf(hand(1.0f, false)) } },
+                    PoseTemplate{ 4, "point", { poseOf(hand(1.0f, true)) } } }, PoseMatchConfig());
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    frame.hands.push_back(hand(1.2f, true));
+    proc.processData(frame.deviceId, frame);
+    ASSERT_EQ(sent.size(), 2u);
+    EXPECT_EQ(sent[0].address, "/leap/dev1/left/pose/id");
+    EXPECT_EQ(sent[0].values[0], 4.0f);
+    EXPECT_EQ(sent[1].address, "/leap/dev1/left/pose/score");
+    EXPECT_NEAR(sent[1].values[0], 1.0f, 1e-3f);
+}
+
+TEST(PoseClassifierTest, ReplacedLibrariesAreReleased) {
+    DeviceAliasManager aliasMgr;
+    DataProcessor first{aliasMgr, [](const OscMessage&) {}, nullptr, nullptr};
+    DataProcessor second{aliasMgr, [](const OscMessage&) {}, nullptr, nullptr};
+    first.setFieldMask(oscFieldBit(OscField::Pose));
+    second.setFieldMask(oscFieldBit(OscField::Pose));
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    frame.hands.push_back(hand(1.0f, false));
+
+    auto library = std::make_shared<const PoseLibrary>(std::vector<PoseTemplate>{ PoseTemplate{ 1, "open", { poseOf(hand(1.0f, false)) } } });
+    std::weak_ptr<const PoseLibrary> watched = library;
+    first.setPoses(library, PoseMatchConfig());
+    second.setPoses(library, PoseMatchConfig()); // One library for both processors
+    first.processData(frame.deviceId, frame);
+    second.processData(frame.deviceId, frame);
+    EXPECT_EQ(library.use_count(), 3); // Ours, and each processor's current config version
+    library.reset();
+
+    // Recording replaces the library; the config versions left behind don't keep it alive
+    for (int i = 0; i < 3; ++i) {
+        auto next = std::make_shared<const PoseLibrary>(std::vector<PoseTemplate>());
+        first.setPoses(next, PoseMatchConfig());
+        second.setPoses(next, PoseMatchConfig());
+    }
+    first.processData(frame.deviceId, frame);
+    second.processData(frame.deviceId, frame);
+    EXPECT_TRUE(watched.expired());
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "../src/core/SkeletonPacket.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include <vector>
+
+namespace {
+HandData makeSkeleton() {
+    HandData hand;
+    hand.handType = HandType::Right;
+    hand.palm.position = {12.5f, 210.25f, -33.0f};
+    hand.palm.orientation = {0.7071f, 0.0f, 0.7071f, 0.0f};
+    hand.arm.wristPosition = {10.0f, 180.0f, -20.0f};
+    hand.arm.elbowPosition = {0.0f, 100.0f, 150.0f};
+    hand.arm.rotation = {0.5f, 0.5f, -0.5f, 0.5f};
+    for (size_t f = 0; f < 5; ++f) {
+        Vector3 joint = {f * 20.0f, 200.0f, -40.0f};
+        hand.fingers[f].bones[0].prevJoint = joint;
+        for (size_t b = 0; b < 4; ++b) {
+            if (b > 0) hand.fingers[f].bones[b].prevJoint = joint;
+            joint.z -= 25.0f + b;
+            hand.fingers[f].bones[b].nextJoint = joint;
+            hand.fingers[f].bones[b].rotation = {1.0f, 0.01f * f, -0.02f * b, 0.0f};
+        }
+    }
+    hand.fingers[3].bones[3].setValid(false);
+    return hand;
+}
+
+void expectNear(const Vector3& a, const Vector3& b, float tolerance) {
+    EXPECT_NEAR(a.x, b.x, tolerance);
+    EXPECT_NEAR(a.y, b.y, tolerance);
+    EXPECT_NEAR(a.z, b.z, tolerance);
+}
+
+void expectRoundTrip(bool quantized, float positionTolerance, float rotationTolerance) {
+    const HandData hand = makeSkeleton();
+    std::vector<uint8_t> packet;
+    encodeSkeleton(hand, quantized, packet);
+    ASSERT_EQ(packet.size(), skeletonPacketSize(quantized));
+
+    HandData decoded;
+    ASSERT_TRUE(decodeSkeleton(packet.data(), packet.size(), decoded));
+    EXPECT_EQ(decoded.handType, HandType::Right);
+    EXPECT_TRUE(decoded.arm.isValid());
+    EXPECT_TRUE(decoded.fingers[2].isValid());
+    EXPECT_FALSE(decoded.fingers[3].isValid());
+    expectNear(decoded.palm.position, hand.palm.position, positionTolerance);
+    expectNear(decoded.arm.elbowPosition, hand.arm.elbowPosition, positionTolerance);
+    for (size_t f = 0; f < 5; ++f) {
+        for (size_t b = 0; b < 4; ++b) {
+            const BoneData& expected = hand.fingers[f].bones[b];
+            const BoneData& actual = decoded.fingers[f].bones[b];
+            expectNear(actual.prevJoint, expected.prevJoint, positionTolerance);
+            expectNear(actual.nextJoint, expected.nextJoint, positionTolerance);
+            EXPECT_NEAR(actual.rotation.w, expected.rotation.w, rotationTolerance);
+            EXPECT_NEAR(actual.rotation.y, expected.rotation.y, rotationTolerance);
+        }
+    }
+    EXPECT_NEAR(decoded.arm.rotation.z, hand.arm.rotation.z, rotationTolerance);
+}
+}
+
+TEST(SkeletonPacketTest, FullPrecisionRoundTripsExactly) {
+    expectRoundTrip(false, 0.0f, 0.0f);
+}
+
+TEST(SkeletonPacketTest, QuantizedRoundTripsWithinOneStep) {
+    expectRoundTrip(true, 0.051f, 1.0f / 32767.0f);
+}
+
+TEST(SkeletonPacketTest, BothHandsFitOneDatagram) {
+    // 1472 = Ethernet MTU minus IP and UDP headers; allow ~40 bytes of OSC framing per message
+    EXPECT_LT(2 * (skeletonPacketSize(false) + 40), 1472u);
+    EXPECT_EQ(skeletonPacketSize(true), 348u);
+}
+
+TEST(SkeletonPacketTest, RejectsMalformedPackets) {
+    std::vector<uint8_t> packet;
+    encodeSkeleton(makeSkeleton(), true, packet);
+    HandData decoded;
+    EXPECT_FALSE(decodeSkeleton(packet.data(), packet.size() - 1, decoded));
+    packet[0] = SKELETON_VERSION + 1;
+    EXPECT_FALSE(decodeSkeleton(packet.data(), packet.size(), decoded));
+}
+
+TEST(SkeletonPacketTest, DataProcessorSendsOneBlobPerHand) {
+    DeviceAliasManager aliasMgr;
+    std::vector<OscMessage> sent;
+    DataProcessor proc(aliasMgr, [&](const OscMessage& msg) { sent.push_back(msg); }, nullptr, nullptr);
+    proc.setFieldMask(oscFieldBit(OscField::Skeleton));
+    proc.setSkeletonQuantized(true);
+
+    FrameData frame;
+    frame.deviceId = "serialA";
+    frame.deviceSlot = 0;
+    frame.hands.push_back(makeSkeleton());
+    proc.processData(frame.deviceId, frame);
+
+    ASSERT_EQ(sent.size(), 1u);
+    EXPECT_EQ(sent[0].address, "/leap/dev1/right/skeleton");
+    EXPECT_TRUE(sent[0].values.empty());
+    HandData decoded;
+    ASSERT_TRUE(decodeSkeleton(sent[0].blob.data(), sent[0].blob.size(), decoded));
+    EXPECT_NEAR(decoded.palm.position.y, 210.25f, 0.051f);
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include "../src/pipeline/01_LeapPoller.hpp"
+#include "../src/pipeline/02_LeapSorter.hpp"
+#include "../src/pipeline/03_DataProcessor.hpp"
+#include "../src/core/FrameData.hpp"
+#include "../src/core/DeviceAliasManager.hpp"
+#include "../src/core/FrameChannel.hpp"
+#include <atomic>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Counts every global operator new while armed. This test binary is its own
+// executable, so replacing the global allocator here affects nothing else.
+namespace {
+std::atomic<bool> g_countAllocations{false};
+std::atomic<size_t> g_allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    if (g_countAllocations.load(std::memory_order_relaxed)) {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+// Builds a LeapC tracking event the way the service would deliver it.
+LEAP_HAND makeLeapHand(eLeapHandType type, float offset) {
+    LEAP_HAND hand{};
+    hand.type = type;
+    hand.confidence = 1.0f;
+    hand.pinch_strength = 0.25f;
+    hand.grab_strength = 0.5f;
+    hand.palm.position.x = offset;
+    hand.palm.position.y = 200.0f;
+    hand.palm.orientation.w = 1.0f;
+    for (int f = 0; f < 5; ++f) {
+        hand.digits[f].finger_id = f;
+        hand.digits[f].is_extended = 1;
+        for (int b = 0; b < 4; ++b) {
+            hand.digits[f].bones[b].next_joint.x = offset + f * 10.0f;
+            hand.digits[f].bones[b].next_joint.y = 200.0f + b * 20.0f;
+        }
+    }
+    return hand;
+}
+
+// Stand-in for the socket: encode into a fixed buffer the way a send would.
+struct FixedBufferSink {
+    std::array<char, 1024> buffer{};
+    size_t messages = 0;
+    void send(const OscMessage& msg) {
+        size_t len = std::min(msg.address.size(), buffer.size() - sizeof(float));
+        std::memcpy(buffer.data(), msg.address.data(), len);
+        if (!msg.values.empty()) {
+            std::memcpy(buffer.data() + len, msg.values.data(), sizeof(float));
+        } else {
+            // Skeleton blobs
+            std::memcpy(buffer.data() + len, msg.blob.data(), std::min(msg.blob.size(), buffer.size() - len));
+        }
+        ++messages;
+    }
+};
+}
+
+TEST(ZeroAllocation, SteadyStateFramePathDoesNotAllocate) {
+    DeviceAliasManager aliasMgr;
+    FixedBufferSink sink;
+    size_t uiFrames = 0;
+
+    DataProcessor processor(
+        aliasMgr,
+        [&](const OscMessage& msg) { sink.send(msg); },
+        [&](const FrameData&, HandMask) { ++uiFrames; },
+        nullptr);
+    // Enable everything so every emission path is exercised
+    processor.setFieldMask(~OscFieldMask(0));
+    SmoothingConfig smoothing;
+    for (OneEuroParams& params : smoothing.groups) params.enabled = true;
+    processor.setSmoothing(smoothing);
+    processor.setPositionOutput(PositionOutput::Both);
+    processor.setInteractionBoxes({}, true);
+
+    LeapSorter sorter([&](const std::string& serial, const FrameData& frame, HandMask hands) {
+        processor.processData(serial, frame, hands);
+    });
+    sorter.setDeviceHand("LPM000000002", "LEFT");
+
+    // Producer side: LeapPoller converts events and publishes them into the
+    // frame channel as LeapInput does; consumer side receives, runs the
+    // sorter/processor and releases, as AppCore does.
+    FrameChannel channel(16);
+    LeapPoller poller(nullptr);
+    poller.setFrameCallback([&](const FrameData& frame) { channel.publish(frame); });
+
+    LEAP_HAND hands[2] = { makeLeapHand(eLeapHandType_Left, -50.0f), makeLeapHand(eLeapHandType_Right, 50.0f) };
+    LEAP_TRACKING_EVENT event{};
+    event.pHands = hands;
+    const std::string serials[2] = { "LPM000000001", "LPM000000002" };
+
+    auto runFrames = [&](int count) {
+        for (int i = 0; i < count; ++i) {
+            // Drop the right hand for a few frames now and then, so hand loss
+            // (zeroing) and regrowing the hands vector are part of the run.
+            event.nHands = (i % 50) < 45 ? 2 : 1;
+            event.info.timestamp = static_cast<int64_t>(i) * 8000;
+            poller.handleTracking(&event, serials[i % 2]);
+            while (FrameData* consumed = channel.receive()) {
+                sorter.processFrame(consumed->deviceId, *consumed);
+                channel.release(consumed);
+            }
+        }
+    };
+
+    // Warm-up: first sight of each device builds its address table and every
+    // pooled frame gets its storage.
+    runFrames(200);
+
+    g_allocationCount = 0;
+    g_countAllocations = true;
+    runFrames(10000);
+    g_countAllocations = false;
+
+    EXPECT_EQ(g_allocationCount.load(), 0u) << "per-frame path touched the heap";
+    EXPECT_EQ(uiFrames, 10200u);
+    EXPECT_GT(sink.messages, 0u);
+}
+
+TEST(ZeroAllocation, InterpolatedSamplingReusesItsBuffer) {
+    // Stand-in for the service's interpolation: the event, then its hands,
+    // in one caller-sized buffer, with the palm moving 1 mm per millisecond.
+    uint64_t sizeCalls = 0;
+    LeapPoller poller(nullptr);
+    LeapPoller::FrameInterpolator interpolator;
+    interpolator.getFrameSize = [&](LEAP_CONNECTION, LEAP_DEVICE, int64_t timestamp, uint64_t* size) {
+        ++sizeCalls;
+        if (timestamp < 0) return eLeapRS_Timeout; // No frames that far back
+        *size = sizeof(LEAP_TRACKING_EVENT) + 2 * sizeof(LEAP_HAND);
+        return eLeapRS_Success;
+    };
+    interpolator.interpolateFrame = [](LEAP_CONNECTION, LEAP_DEVICE, int64_t timestamp, LEAP_TRACKING_EVENT* event, uint64_t size) {
+        if (size < sizeof(LEAP_TRACKING_EVENT) + 2 * sizeof(LEAP_HAND)) return eLeapRS_InsufficientBuffer;
+        auto* hands = reinterpret_cast<LEAP_HAND*>(event + 1);
+        hands[0] = makeLeapHand(eLeapHandType_Left, timestamp / 1000.0f);
+        hands[1] = makeLeapHand(eLeapHandType_Right, 50.0f);
+        *event = LEAP_TRACKING_EVENT{};
+        event->info.timestamp = timestamp;
+        event->nHands = 2;
+        event->pHands = hands;
+        return eLeapRS_Success;
+    };
+    poller.setFrameInterpolator(interpolator);
+
+    uint64_t frames = 0, lastTimestamp = 0;
+    float lastX = 0.0f;
+    poller.setFrameCallback([&](const FrameData& frame) {
+        ++frames;
+        lastTimestamp = frame.timestamp;
+        lastX = frame.hands[0].palm.position.x;
+    });
+    LeapPoller::DeviceInfo device;
+    device.serialNumber = "LPM000000001";
+
+    EXPECT_FALSE(poller.sampleDevice(device, -1000));
+    ASSERT_TRUE(poller.sampleDevice(device, 0)); // Warm-up: the buffer grows once
+
+    g_allocationCount = 0;
+    g_countAllocations = true;
+    for (int64_t t = 1; t <= 1000; ++t) poller.sampleDevice(device, t * 2000); // 500 Hz
+    g_countAllocations = false;
+
+    EXPECT_EQ(g_allocationCount.load(), 0u) << "interpolated sampling touched the heap";
+    EXPECT_EQ(frames, 1001u);
+    EXPECT_EQ(sizeCalls, 1002u);
+    EXPECT_EQ(lastTimestamp, 2'000'000u); // The requested time, not the last event's
+    EXPECT_FLOAT_EQ(lastX, 2000.0f);
+}